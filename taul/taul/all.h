@@ -45,20 +45,30 @@
 #include "symbol_observer.h"
 #include "symbol_stream.h"
 #include "symbol_filter.h"
+#include "pipelined_token_filter.h"
 
 #include "source_pos_counter.h"
 #include "parse_tree.h"
 #include "parse_tree_pattern.h"
+#include "parse_limits.h"
 
 #include "reader.h"
 #include "source_reader.h"
+#include "chunk_reader.h"
+#include "token_queue.h"
+#include "token_buffer.h"
 
 #include "base_lexer.h"
 #include "base_parser.h"
 #include "lexer.h"
 #include "parser.h"
+#include "push_parser.h"
+#include "parse_pipeline.h"
+#include "batch_parser.h"
+#include "region_parser.h"
 
 #include "listener.h"
+#include "listener_bus.h"
 
 #include "error_handler.h"
 #include "regular_error_handler.h"
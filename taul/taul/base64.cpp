@@ -133,6 +133,7 @@ std::optional<std::string> taul::internal::base64_encode_text(std::span<const ui
 
 std::optional<std::vector<uint8_t>> taul::internal::base64_decode_text(std::string_view x) {
     std::vector<uint8_t> r{};
+    r.reserve(x.length() / 4 * 3 + 3); // alloc up-front to avoid reallocs
     size_t chars_decoded = 0;
     while (chars_decoded < x.length()) {
         // prepare eu
@@ -120,6 +120,20 @@ namespace taul {
         virtual bool eh_done() = 0; // forwards 'done' call to lexer
 
         virtual bool eh_check() = 0; // checks if parser error has been recovered from
+
+        // eh_recover skips input until either eh_check or eh_done return true,
+        // returning if the error was recovered from
+
+        // by default this loops eh_done/eh_check/eh_next, w/ impls able to
+        // override it to avoid going through their own eh_* methods per token
+
+        inline virtual bool eh_recover() {
+            while (!eh_done()) {
+                if (eh_check()) return true;
+                eh_next();
+            }
+            return false;
+        }
     };
 }
 
@@ -0,0 +1,163 @@
+
+
+#include "batch_parser.h"
+
+
+taul::batch_parser::_worker::_worker(grammar gram, std::shared_ptr<logger> lgr)
+    : pipeline(gram, lgr) {}
+
+taul::batch_parser::batch_parser(grammar gram, size_t workers, std::shared_ptr<logger> lgr)
+    : api_component(lgr),
+    gram(gram) {
+    if (workers == 0) workers = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    _workers.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        _workers.push_back(std::make_unique<_worker>(gram, lgr));
+    }
+    // start threads only after all workers exist, as they may steal from one another
+    for (size_t i = 0; i < workers; i++) {
+        _workers[i]->thread = std::thread([this, i] { _work(i); });
+    }
+}
+
+taul::batch_parser::~batch_parser() noexcept {
+    _stop.store(true);
+    _generation.fetch_add(1);
+    _generation.notify_all();
+    for (const auto& w : _workers) w->thread.join();
+}
+
+size_t taul::batch_parser::workers() const noexcept {
+    return _workers.size();
+}
+
+void taul::batch_parser::bind_error_handler_factory(error_handler_factory factory) {
+    for (const auto& w : _workers) {
+        w->eh = factory ? factory() : nullptr;
+        w->pipeline.bind_error_handler(w->eh.get());
+    }
+}
+
+std::vector<taul::parse_tree> taul::batch_parser::parse(ppr_ref start_rule, std::span<const str> inputs, const listener_provider& listeners) {
+    std::vector<std::optional<parse_tree>> results(inputs.size());
+    _run_batch(start_rule, inputs, listeners ? &listeners : nullptr, &results);
+    std::vector<parse_tree> result{};
+    result.reserve(results.size());
+    for (auto& x : results) result.push_back(std::move(x.value()));
+    return result;
+}
+
+std::vector<taul::parse_tree> taul::batch_parser::parse(const str& name, std::span<const str> inputs, const listener_provider& listeners) {
+    TAUL_ASSERT(gram.has_ppr(name));
+    return parse(gram.ppr(name).value(), inputs, listeners);
+}
+
+void taul::batch_parser::parse_notree(ppr_ref start_rule, std::span<const str> inputs, const listener_provider& listeners) {
+    _run_batch(start_rule, inputs, listeners ? &listeners : nullptr, nullptr);
+}
+
+void taul::batch_parser::parse_notree(const str& name, std::span<const str> inputs, const listener_provider& listeners) {
+    TAUL_ASSERT(gram.has_ppr(name));
+    parse_notree(gram.ppr(name).value(), inputs, listeners);
+}
+
+void taul::batch_parser::_run_batch(ppr_ref start_rule, std::span<const str> inputs, const listener_provider* listeners, std::vector<std::optional<parse_tree>>* results) {
+    TAUL_ASSERT(gram.is_associated(start_rule));
+    TAUL_ASSERT(inputs.size() <= size_t(std::numeric_limits<std::uint32_t>::max()));
+    if (inputs.empty()) return;
+    _start_rule = start_rule;
+    _inputs = inputs;
+    _listeners = listeners;
+    _results = results;
+    // split the documents into contiguous ranges, one per worker
+    const size_t n = inputs.size();
+    for (size_t i = 0; i < _workers.size(); i++) {
+        const auto begin = std::uint32_t(n * i / _workers.size());
+        const auto end = std::uint32_t(n * (i + 1) / _workers.size());
+        _workers[i]->range.store(_pack(begin, end));
+    }
+    _active.store(_workers.size());
+    _generation.fetch_add(1); // <- publishes the above to the workers
+    _generation.notify_all();
+    // wait for the workers to finish the batch
+    while (true) {
+        const size_t active = _active.load();
+        if (active == 0) break;
+        _active.wait(active);
+    }
+    _listeners = nullptr;
+    _results = nullptr;
+}
+
+void taul::batch_parser::_work(size_t worker_index) {
+    _worker& w = *_workers[worker_index];
+    std::uint64_t seen = 0;
+    while (true) {
+        _generation.wait(seen);
+        seen = _generation.load();
+        if (_stop.load()) break;
+        // parse our own documents, stealing more once we run out, until
+        // there's no more to steal
+        do {
+            size_t index{};
+            while (_take(w, index)) _parse_document(w, index);
+        } while (_steal(worker_index));
+        // only we add to our range, and it's empty, so once every worker gets here
+        // every document has been parsed
+        if (_active.fetch_sub(1) == 1) _active.notify_all();
+    }
+}
+
+void taul::batch_parser::_parse_document(_worker& w, size_t index) {
+    w.pipeline.bind_listener(_listeners ? (*_listeners)(index) : nullptr);
+    // copying the pipeline's tree results in a single exact-size alloc, rather
+    // than the several of growing a new tree's node array
+    if (_results) (*_results)[index] = w.pipeline.parse(_inputs[index], _start_rule.value());
+    else w.pipeline.parse_notree(_inputs[index], _start_rule.value());
+}
+
+bool taul::batch_parser::_take(_worker& w, size_t& index) {
+    auto range = w.range.load();
+    while (true) {
+        const auto begin = _begin(range), end = _end(range);
+        if (begin >= end) return false;
+        if (w.range.compare_exchange_weak(range, _pack(begin + 1, end))) {
+            index = size_t(begin);
+            return true;
+        }
+    }
+}
+
+bool taul::batch_parser::_steal(size_t thief_index) {
+    // try each other worker in turn, starting w/ the next one, so thieves
+    // spread out, rather than all targeting the same victim
+    for (size_t i = 1; i < _workers.size(); i++) {
+        _worker& victim = *_workers[(thief_index + i) % _workers.size()];
+        auto range = victim.range.load();
+        while (true) {
+            const auto begin = _begin(range), end = _end(range);
+            if (begin >= end) break;
+            const auto n = (end - begin + 1) / 2; // steal the back half, rounding up
+            if (victim.range.compare_exchange_weak(range, _pack(begin, end - n))) {
+                // only the owner takes from its own range, and it's empty, so a
+                // plain store is fine (thieves won't modify an empty range)
+                _workers[thief_index]->range.store(_pack(end - n, end));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::uint64_t taul::batch_parser::_pack(std::uint32_t begin, std::uint32_t end) noexcept {
+    return (std::uint64_t(begin) << 32) | std::uint64_t(end);
+}
+
+std::uint32_t taul::batch_parser::_begin(std::uint64_t range) noexcept {
+    return std::uint32_t(range >> 32);
+}
+
+std::uint32_t taul::batch_parser::_end(std::uint64_t range) noexcept {
+    return std::uint32_t(range);
+}
+
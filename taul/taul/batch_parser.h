@@ -0,0 +1,149 @@
+
+
+#pragma once
+
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "parse_pipeline.h"
+
+
+namespace taul {
+
+
+    // batch_parser parses *batches* of many (usually small) documents against
+    // a single grammar, distributing them across a pool of worker threads
+
+    // each worker thread owns a reusable parse_pipeline, which is built once,
+    // upon construction, and then reused for each of the documents it parses,
+    // so per-document setup is just a reset
+
+    // documents are distributed via *work stealing*, w/ each worker being
+    // given a contiguous range of documents, and workers who run out of
+    // documents stealing half of the remaining documents of another
+
+    // the thread calling parse/parse_notree blocks until the batch is done
+
+    // behaviour is undefined if parse/parse_notree are called concurrently,
+    // or if listeners/error handlers throw
+
+
+    class batch_parser final : public api_component {
+    public:
+
+        // listener_provider returns the listener to use for the document
+        // at index (or nullptr), w/ it being called on the worker thread
+        // which is to parse the document, just prior to doing so
+
+        using listener_provider = std::function<listener*(size_t index)>;
+
+        // error_handler_factory creates an error handler for a worker
+
+        using error_handler_factory = std::function<std::shared_ptr<error_handler>()>;
+
+
+        // if workers == 0, std::thread::hardware_concurrency is used
+
+        batch_parser(grammar gram, size_t workers = 0, std::shared_ptr<logger> lgr = nullptr);
+
+        batch_parser(const batch_parser&) = delete;
+        batch_parser(batch_parser&&) = delete;
+
+        virtual ~batch_parser() noexcept;
+
+        batch_parser& operator=(const batch_parser&) = delete;
+        batch_parser& operator=(batch_parser&&) = delete;
+
+
+        const grammar gram;
+
+
+        // workers returns the number of worker threads
+
+        size_t workers() const noexcept;
+
+        // bind_error_handler_factory binds factory to be used to create the
+        // error handler of each worker's parser, if any
+
+        // behaviour is undefined if called during parse/parse_notree
+
+        void bind_error_handler_factory(error_handler_factory factory);
+
+
+        // parse parses each of inputs, returning their parse trees, in
+        // the same order as inputs
+
+        // listeners, if provided, are run for each document alongside
+        // building their parse trees
+
+        std::vector<parse_tree> parse(ppr_ref start_rule, std::span<const str> inputs, const listener_provider& listeners = nullptr);
+        std::vector<parse_tree> parse(const str& name, std::span<const str> inputs, const listener_provider& listeners = nullptr);
+
+        // parse_notree parses each of inputs, w/out producing parse trees,
+        // w/ output being received via listeners
+
+        void parse_notree(ppr_ref start_rule, std::span<const str> inputs, const listener_provider& listeners);
+        void parse_notree(const str& name, std::span<const str> inputs, const listener_provider& listeners);
+
+
+    private:
+
+        // each worker's state is cache line aligned, so workers don't
+        // contend over cache lines (ie. false sharing)
+
+        struct alignas(64) _worker final {
+            parse_pipeline pipeline;
+            std::shared_ptr<error_handler> eh;
+
+            // the range of document indices this worker has yet to parse, w/
+            // the high 32 bits being the begin index, and the low 32 bits
+            // being the end index
+
+            std::atomic<std::uint64_t> range = 0;
+
+            std::thread thread;
+
+
+            _worker(grammar gram, std::shared_ptr<logger> lgr);
+        };
+
+
+        std::vector<std::unique_ptr<_worker>> _workers;
+
+        // the current batch
+
+        std::optional<ppr_ref> _start_rule;
+        std::span<const str> _inputs;
+        const listener_provider* _listeners = nullptr;
+        std::vector<std::optional<parse_tree>>* _results = nullptr; // nullptr for parse_notree
+
+        alignas(64) std::atomic<std::uint64_t> _generation = 0; // incremented to start batches
+
+        // the batch is only done once every worker has stopped looking for work, rather
+        // than once every document has been parsed, as otherwise a straggling worker
+        // could still be trying to steal when the next batch's ranges are being stored
+
+        alignas(64) std::atomic<size_t> _active = 0; // workers yet to finish the batch
+        std::atomic<bool> _stop = false;
+
+
+        void _run_batch(ppr_ref start_rule, std::span<const str> inputs, const listener_provider* listeners, std::vector<std::optional<parse_tree>>* results);
+
+        void _work(size_t worker_index);
+        void _parse_document(_worker& w, size_t index);
+
+        static bool _take(_worker& w, size_t& index);
+        bool _steal(size_t thief_index);
+
+        static std::uint64_t _pack(std::uint32_t begin, std::uint32_t end) noexcept;
+        static std::uint32_t _begin(std::uint64_t range) noexcept;
+        static std::uint32_t _end(std::uint64_t range) noexcept;
+    };
+}
+
@@ -0,0 +1,106 @@
+
+
+#include "chunk_reader.h"
+
+
+taul::chunk_reader::chunk_reader(encoding in_e)
+    : reader(),
+    _in_e(in_e),
+    _observer(nullptr) {}
+
+void taul::chunk_reader::bind_observer(glyph_observer* observer) {
+    _observer = observer;
+    _observer_ownership.reset();
+}
+
+void taul::chunk_reader::bind_observer(std::shared_ptr<glyph_observer> observer) {
+    _observer = observer.get();
+    _observer_ownership = observer;
+}
+
+taul::glyph taul::chunk_reader::peek() {
+    return _peek();
+}
+
+taul::glyph taul::chunk_reader::next() {
+    glyph result = _peek();
+    if (_observer) _observer->observe(result);
+    _current += result.len; // advance input state (end-of-input glyphs have len of 0)
+    return result;
+}
+
+bool taul::chunk_reader::done() {
+    return _done();
+}
+
+void taul::chunk_reader::reset() {
+    _current = 0;
+    _starved = false;
+}
+
+void taul::chunk_reader::feed(std::span<const char> chunk) {
+    TAUL_ASSERT(!_finished);
+    _buffer.append(chunk.data(), chunk.size());
+}
+
+void taul::chunk_reader::finish() {
+    _finished = true;
+}
+
+void taul::chunk_reader::clear() {
+    _buffer.clear();
+    _base = 0;
+    _current = 0;
+    _finished = false;
+    _starved = false;
+}
+
+bool taul::chunk_reader::finished() const noexcept {
+    return _finished;
+}
+
+bool taul::chunk_reader::starved() const noexcept {
+    return _starved;
+}
+
+void taul::chunk_reader::unstarve() noexcept {
+    _starved = false;
+}
+
+void taul::chunk_reader::discard() {
+    _buffer.erase(0, _current);
+    _base += source_pos(_current);
+    _current = 0;
+}
+
+size_t taul::chunk_reader::buffered() const noexcept {
+    return _buffer.size();
+}
+
+taul::chunk_reader::checkpoint_t taul::chunk_reader::checkpoint() const noexcept {
+    return _base + source_pos(_current);
+}
+
+void taul::chunk_reader::restore(checkpoint_t cp) {
+    TAUL_ASSERT(cp >= _base);
+    TAUL_ASSERT(cp - _base <= _buffer.size());
+    _current = size_t(cp - _base);
+}
+
+taul::glyph taul::chunk_reader::_peek() {
+    const source_pos pos = _base + source_pos(_current);
+    const auto remaining = std::string_view(_buffer).substr(_current);
+    const auto data = decode<char>(_in_e, remaining);
+    if (data) return glyph::normal(data.value().cp, pos, source_len(data.value().chars<char>()));
+    // if we fail to decode a unit prior to finish, and there's too few chars left
+    // to hold a full unit, we presume it to be a partial unit (or one which has
+    // yet to arrive) and so become starved, w/ invalid units otherwise ending
+    // input, as w/ source_reader
+    if (!_finished && remaining.size() < _max_unit_chars) _starved = true;
+    return glyph::end(pos); // fail safe
+}
+
+bool taul::chunk_reader::_done() const {
+    return _finished && _current == _buffer.size();
+}
+
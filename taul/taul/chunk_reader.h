@@ -0,0 +1,120 @@
+
+
+#pragma once
+
+
+#include <span>
+
+#include "str.h"
+#include "encoding.h"
+#include "reader.h"
+
+
+namespace taul {
+
+
+    // chunk_reader is a reader who's input arrives incrementally, in
+    // *chunks*, w/ the end-user pushing them via feed, and then
+    // calling finish once all input has arrived
+
+    // chunks may split multi-char encoded units, w/ the reader
+    // holding partial units until the rest of them arrive
+
+    // prior to finish, upon querying a glyph which has yet to arrive,
+    // the reader returns an end-of-input glyph, and marks itself as
+    // *starved*, letting downstream components discern that their 
+    // output may be incomplete (see push_parser)
+
+    // glyph positions are relative to the start of all input fed to
+    // the reader, including input which has been discarded
+
+
+    class chunk_reader final : public reader {
+    public:
+
+        chunk_reader(encoding in_e = utf8);
+
+        virtual ~chunk_reader() noexcept = default;
+
+
+        virtual void bind_observer(glyph_observer* observer) override final;
+        virtual void bind_observer(std::shared_ptr<glyph_observer> observer) override final;
+        virtual glyph peek() override final;
+        virtual glyph next() override final;
+        virtual bool done() override final;
+
+        // reset rewinds the reader to the start of its non-discarded input
+
+        void reset() override final;
+
+
+        // feed pushes a new chunk of input to the reader
+
+        // behaviour is undefined if called after finish
+
+        void feed(std::span<const char> chunk);
+
+        // finish specifies that all input has arrived
+
+        void finish();
+
+        // clear discards all input, and undoes finish, letting the
+        // reader be reused for new input
+
+        void clear();
+
+        // finished returns if finish has been called
+
+        bool finished() const noexcept;
+
+        // starved returns if a glyph which has yet to arrive has been
+        // queried since the last unstarve call
+
+        bool starved() const noexcept;
+
+        void unstarve() noexcept;
+
+        // discard frees input prior to the current read position, 
+        // which may no longer be read again, ie. via reset
+
+        void discard();
+
+        // buffered returns the number of chars of input currently held
+
+        size_t buffered() const noexcept;
+
+
+        // checkpoint/restore are used to capture, and later restore, the
+        // read position of the reader
+
+        // behaviour is undefined if restoring a read position which has
+        // since been discarded
+
+        using checkpoint_t = source_pos;
+
+        checkpoint_t checkpoint() const noexcept;
+        void restore(checkpoint_t cp);
+
+
+    private:
+
+        encoding _in_e;
+        std::string _buffer; // the non-discarded input
+        source_pos _base = 0; // the pos of the first char of _buffer
+        size_t _current = 0; // the read position, as an index into _buffer
+        bool _finished = false;
+        bool _starved = false;
+
+        static constexpr size_t _max_unit_chars = 4; // max chars per encoded unit
+
+        glyph_observer* _observer;
+        std::shared_ptr<glyph_observer> _observer_ownership;
+
+
+        // these help avoid virtual call indirection
+
+        glyph _peek();
+        bool _done() const;
+    };
+}
+
@@ -2,12 +2,20 @@
 
 #include "export_fetcher.h"
 
+#include <map>
+
 #include "asserts.h"
 
+#include "internal/grammar_data.h"
+
 
 using namespace taul::string_literals;
 
 
+static constexpr size_t _serial_str_chunk_len = 4096;
+static constexpr size_t _image_bytes_per_line = 16;
+
+
 static std::string _fmt_include_txt(
     const char* taul_include_name,
     const char* taul_include_path_prefix,
@@ -21,12 +29,103 @@ static std::string _fmt_include_txt(
 }
 
 
+// predictors are written as a switch over non-terminal IDs, w/ each case then
+// dispatching on terminal ID, w/ narrow terminal ID ranges being dispatched via
+// a switch, and wide ones via a binary decision tree of comparisons
+
+static constexpr taul::symbol_id_num _predictor_max_case_range = 8;
+
+struct _predictor_run final {
+    taul::symbol_id_num low, high;
+    size_t rule;
+};
+
+static std::string _fmt_indent(const char* tab, size_t n) {
+    std::string result{};
+    for (size_t i = 0; i < n; i++) result += tab;
+    return result;
+}
+
+static void _write_predictor_tree(std::string& src, std::span<const _predictor_run> runs, const char* tab, size_t indent) {
+    const auto in = _fmt_indent(tab, indent);
+    if (runs.size() <= 2) {
+        for (const auto& I : runs) {
+            // omit 't >= 0' so as to avoid compiler warnings about it always being true
+            if (I.low == 0) src += std::format("{}if (t <= {:#x}) return {};\n", in, I.high, I.rule);
+            else src += std::format("{}if (t >= {:#x} && t <= {:#x}) return {};\n", in, I.low, I.high, I.rule);
+        }
+        return;
+    }
+    const size_t mid = runs.size() / 2;
+    src += std::format("{}if (t < {:#x}) {{\n", in, runs[mid].low);
+    _write_predictor_tree(src, runs.subspan(0, mid), tab, indent + 1);
+    src += std::format("{0}}}\n{0}else {{\n", in);
+    _write_predictor_tree(src, runs.subspan(mid), tab, indent + 1);
+    src += std::format("{}}}\n", in);
+}
+
+template<typename Symbol, typename RuleName>
+static void _write_predictor(std::string& src, const taul::internal::parse_table<Symbol>& pt, const char* name, RuleName&& rule_name, const char* tab) {
+    // gather each non-terminal's mappings as runs of terminal IDs, w/ neighboring
+    // groups mapping to the same rule being merged
+    std::map<taul::symbol_id_num, std::vector<_predictor_run>> runs{};
+    for (const auto& [k, v] : pt.mappings) {
+        const auto range = pt.grouper.get_symbol_range(k.terminal_group);
+        runs[taul::symbol_id_num(k.nonterminal)].push_back(_predictor_run{ taul::symbol_id_num(range.low), taul::symbol_id_num(range.high), v });
+    }
+    for (auto& [nonterminal, x] : runs) {
+        std::sort(x.begin(), x.end(), [](const auto& a, const auto& b) { return a.low < b.low; });
+        std::vector<_predictor_run> merged{};
+        for (const auto& I : x) {
+            if (!merged.empty() && merged.back().high + 1 == I.low && merged.back().rule == I.rule) merged.back().high = I.high;
+            else merged.push_back(I);
+        }
+        x = std::move(merged);
+    }
+    const auto in3 = _fmt_indent(tab, 3);
+    const auto in4 = _fmt_indent(tab, 4);
+    const auto in5 = _fmt_indent(tab, 5);
+    src += std::format("{}static constexpr std::optional<size_t> {}(taul::symbol_id nonterminal, taul::symbol_id terminal) noexcept {{\n", in3, name);
+    src += std::format("{}[[maybe_unused]] const auto t = taul::symbol_id_num(terminal);\n", in4);
+    src += std::format("{}switch (taul::symbol_id_num(nonterminal)) {{\n", in4);
+    for (const auto& [nonterminal, x] : runs) {
+        const std::string nonterminal_name = rule_name(taul::symbol_id(nonterminal));
+        src += std::format("{}case {:#x}: {{{}\n", in4, nonterminal, nonterminal_name.empty() ? "" : " // " + nonterminal_name);
+        std::vector<_predictor_run> wide{};
+        bool has_narrow = false;
+        for (const auto& I : x) {
+            if (I.high - I.low >= _predictor_max_case_range) {
+                wide.push_back(I);
+                continue;
+            }
+            if (!has_narrow) src += std::format("{}switch (t) {{\n", in5);
+            has_narrow = true;
+            src += in5;
+            for (auto id = I.low; id <= I.high; id++) src += std::format("case {:#x}: ", id);
+            src += std::format("return {};\n", I.rule);
+        }
+        if (has_narrow) {
+            src += std::format("{}default: break;\n", in5);
+            src += std::format("{}}}\n", in5);
+        }
+        _write_predictor_tree(src, wide, tab, 5);
+        src += std::format("{}return std::nullopt;\n", in5);
+        src += std::format("{}}}\n", in4);
+    }
+    src += std::format("{}default: return std::nullopt;\n", in4);
+    src += std::format("{}}}\n", in4);
+    src += std::format("{}}}\n", in3);
+}
+
+
 taul::source_code taul::export_fetcher(
     const grammar& gram,
     const char* fetcher,
     const char* taul_include_path,
     bool taul_includes_use_triangle_brackets,
-    const char* tab) {
+    const char* tab,
+    bool use_image,
+    bool use_predictors) {
     TAUL_ASSERT(fetcher);
     TAUL_ASSERT(taul_include_path);
     TAUL_ASSERT(tab);
@@ -38,7 +137,9 @@ taul::source_code taul::export_fetcher(
     
     std::string src{};
     src += std::format("#pragma once\n");
+    src += std::format("#include <cstdint>\n");
     src += std::format("#include <string_view>\n");
+    src += std::format("#include <span>\n");
     src += std::format("#include <optional>\n");
     src += std::format("#include {0}\n", _include_txt("grammar.h"));
     src += std::format("#include {0}\n", _include_txt("export_fetcher.h"));
@@ -48,9 +149,46 @@ taul::source_code taul::export_fetcher(
     // write our internal::export_fetcher_singleton_traits impl
     src += std::format("{0}namespace details {{\n", tab);
     src += std::format("{0}{0}struct {1}_singleton_traits final {{\n", tab, fetcher);
-    src += std::format("{0}{0}{0}static constexpr std::string_view get_serial_str() noexcept {{\n", tab);
-    src += std::format("{0}{0}{0}{0}return \"{1}\";\n", tab, gram.serialize());
-    src += std::format("{0}{0}{0}}}\n", tab);
+    if (use_image) {
+        // write image as an array of bytes, w/ a fixed number per line
+        const auto image = gram.image();
+        src += std::format("{0}{0}{0}static constexpr uint8_t image[] = {{", tab);
+        for (size_t i = 0; i < image.size(); i++) {
+            if (i % _image_bytes_per_line == 0) src += std::format("\n{0}{0}{0}{0}", tab);
+            src += std::format("0x{:02x},", image[i]);
+        }
+        src += std::format("\n{0}{0}{0}}};\n", tab);
+        src += std::format("{0}{0}{0}static constexpr std::span<const uint8_t> get_image() noexcept {{\n", tab);
+        src += std::format("{0}{0}{0}{0}return image;\n", tab);
+        src += std::format("{0}{0}{0}}}\n", tab);
+    }
+    else {
+        src += std::format("{0}{0}{0}static constexpr std::string_view get_serial_str() noexcept {{\n", tab);
+        // serialized grammars can get quite large, so split them across multiple
+        // string literals, as some compilers (ie. MSVC) limit literal length
+        const auto serialized = gram.serialize();
+        src += std::format("{0}{0}{0}{0}return", tab);
+        for (size_t i = 0; i < serialized.length(); i += _serial_str_chunk_len) {
+            src += std::format("\n{0}{0}{0}{0}{0}\"{1}\"", tab, std::string_view(serialized).substr(i, _serial_str_chunk_len));
+        }
+        src += std::format(";\n");
+        src += std::format("{0}{0}{0}}}\n", tab);
+    }
+    if (use_predictors) {
+        const auto& gramdat = internal::launder_grammar_data(gram);
+        auto lpr_name =
+            [&](symbol_id id) -> std::string {
+            const size_t index = size_t(id - symbol_traits<glyph>::first_nonterminal_id);
+            return index < gram.lprs() ? std::string(gram.lpr_at(index).name()) : std::string{};
+            };
+        auto ppr_name =
+            [&](symbol_id id) -> std::string {
+            const size_t index = size_t(id - symbol_traits<token>::first_nonterminal_id);
+            return index < gram.pprs() ? std::string(gram.ppr_at(index).name()) : std::string{};
+            };
+        _write_predictor(src, gramdat._lpr_pt, "predict_lpr", lpr_name, tab);
+        _write_predictor(src, gramdat._ppr_pt, "predict_ppr", ppr_name, tab);
+    }
     src += std::format("{0}{0}}};\n", tab);
     src += std::format("{0}}}\n", tab);
 
@@ -3,8 +3,9 @@
 #pragma once
 
 
+#include <cstdint>
 #include <optional>
-#include <mutex>
+#include <span>
 
 #include "source_code.h"
 #include "grammar.h"
@@ -13,51 +14,103 @@
 namespace taul {
 
 
-    // TODO: this function has not been unit tested (I just *eyeballed* it)
+    // TODO: the source code generated by this function is not compiled by our unit
+    //       tests (I just *eyeballed* it)
 
     // export creates a source code object encapsulating a C++ header file defining
     // a 'fetcher' function which returns a copy of the grammar
 
+    // if use_predictors is true, direct-coded predictors (see internal::pt_predictor)
+    // are generated for the grammar's LPRs and PPRs, w/ these replacing parse table
+    // lookups during lexing/parsing, making the header larger, but lexing/parsing faster
+
+    // if use_image is true, the grammar is embedded as a static array containing
+    // its binary image (see grammar::image), rather than as a serialized string,
+    // making the header larger, but the grammar faster to load
+
     source_code export_fetcher(
         const grammar& gram,
         const char* fetcher,
         const char* taul_include_path = "taul",
         bool taul_includes_use_triangle_brackets = false,
-        const char* tab = "    ");
+        const char* tab = "    ",
+        bool use_image = false,
+        bool use_predictors = false);
 
 
     namespace internal {
         template<typename T>
-        concept export_fetcher_singleton_traits =
+        concept export_fetcher_singleton_serial_str_traits =
             requires
         {
             { T::get_serial_str() } noexcept -> std::convertible_to<std::string_view>;
         };
 
+        template<typename T>
+        concept export_fetcher_singleton_image_traits =
+            requires
+        {
+            { T::get_image() } noexcept -> std::convertible_to<std::span<const uint8_t>>;
+        };
+
+        template<typename T>
+        concept export_fetcher_singleton_traits =
+            export_fetcher_singleton_serial_str_traits<T> ||
+            export_fetcher_singleton_image_traits<T>;
+
+        // traits may optionally also provide predictors for the grammar
+
+        template<typename T>
+        concept export_fetcher_singleton_lpr_predictor_traits =
+            requires(symbol_id nonterminal, symbol_id terminal)
+        {
+            { T::predict_lpr(nonterminal, terminal) } noexcept -> std::same_as<std::optional<size_t>>;
+        };
+
+        template<typename T>
+        concept export_fetcher_singleton_ppr_predictor_traits =
+            requires(symbol_id nonterminal, symbol_id terminal)
+        {
+            { T::predict_ppr(nonterminal, terminal) } noexcept -> std::same_as<std::optional<size_t>>;
+        };
+
         template<export_fetcher_singleton_traits Traits>
         class export_fetcher_singleton final {
         public:
             export_fetcher_singleton() = default;
 
 
+            // the grammar is loaded upon first call, w/ this being thread-safe, and
+            // w/ subsequent calls not needing to acquire any locks
+
             static inline grammar fetch() {
-                if (!_gram) {
-                    std::scoped_lock lock(_mtx);
-                    _gram = grammar::deserialize(Traits::get_serial_str());
-                }
-                return deref_assert(_gram);
+                static const grammar gram = deref_assert(_load());
+                return gram;
             }
 
 
         private:
-            static std::optional<grammar> _gram;
-            static std::mutex _mtx;
-        };
+            static inline std::optional<grammar> _load() {
+                auto result = _load_grammar();
+                if (result) {
+                    pt_predictor lpr_predictor = nullptr;
+                    pt_predictor ppr_predictor = nullptr;
+                    if constexpr (export_fetcher_singleton_lpr_predictor_traits<Traits>) lpr_predictor = &Traits::predict_lpr;
+                    if constexpr (export_fetcher_singleton_ppr_predictor_traits<Traits>) ppr_predictor = &Traits::predict_ppr;
+                    bind_predictors(*result, lpr_predictor, ppr_predictor);
+                }
+                return result;
+            }
 
-        template<export_fetcher_singleton_traits Traits>
-        std::optional<grammar> export_fetcher_singleton<Traits>::_gram = std::nullopt;
-        template<export_fetcher_singleton_traits Traits>
-        std::mutex export_fetcher_singleton<Traits>::_mtx = std::mutex();
+            static inline std::optional<grammar> _load_grammar() {
+                if constexpr (export_fetcher_singleton_image_traits<Traits>) {
+                    return grammar::from_image(Traits::get_image());
+                }
+                else {
+                    return grammar::deserialize(Traits::get_serial_str());
+                }
+            }
+        };
     }
 }
 
@@ -290,7 +290,37 @@ std::optional<taul::grammar> taul::grammar::deserialize(std::string_view x) {
     return std::nullopt;
 }
 
+// binary images are prefixed by this magic number, w/ the version of the
+// data therein being encoded by grammar_data itself
+
+static constexpr std::string_view _image_magic = std::string_view("TAULIMG\0", 8);
+
+std::vector<uint8_t> taul::grammar::image() const {
+    internal::buff b{};
+    b.bytes.assign(_image_magic.begin(), _image_magic.end());
+    if (_data) _data->serialize(b);
+    return std::move(b.bytes);
+}
+
+std::optional<taul::grammar> taul::grammar::from_image(std::span<const uint8_t> x) {
+    if (x.size() < _image_magic.length()) return std::nullopt;
+    if (std::string_view((const char*)x.data(), _image_magic.length()) != _image_magic) return std::nullopt;
+    auto rdr = internal::buff_reader(x, _image_magic.length());
+    if (auto gramdat = internal::grammar_data::deserialize(rdr)) {
+        if (rdr.remaining() == 0) {
+            return grammar(std::move(*gramdat));
+        }
+    }
+    return std::nullopt;
+}
+
 const taul::internal::grammar_data& taul::internal::launder_grammar_data(const grammar& x) noexcept {
     return deref_assert(x._data);
 }
 
+void taul::internal::bind_predictors(grammar& x, pt_predictor lpr_predictor, pt_predictor ppr_predictor) noexcept {
+    auto& gramdat = deref_assert(x._data);
+    if (lpr_predictor) gramdat._lpr_pt.predictor = lpr_predictor;
+    if (ppr_predictor) gramdat._ppr_pt.predictor = ppr_predictor;
+}
+
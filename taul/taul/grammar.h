@@ -216,6 +216,21 @@ namespace taul {
 
     namespace internal {
         const grammar_data& launder_grammar_data(const grammar& x) noexcept;
+
+
+        // pt_predictor is a direct-coded replacement for parse table lookup, mapping
+        // non-terminal and terminal IDs directly to parse table rule indices, w/ these
+        // being generated by export_fetcher for a specific grammar
+
+        using pt_predictor = std::optional<size_t>(*)(symbol_id nonterminal, symbol_id terminal) noexcept;
+
+        // bind_predictors binds predictors to the LPR/PPR parse tables of x, w/
+        // nullptr predictors being ignored
+
+        // behaviour is undefined if predictors were not generated from x, or if
+        // x's state is in use by other threads (ie. only call while loading x)
+
+        void bind_predictors(grammar& x, pt_predictor lpr_predictor, pt_predictor ppr_predictor) noexcept;
     }
 
 
@@ -225,6 +240,7 @@ namespace taul {
     public:
 
         friend const internal::grammar_data& internal::launder_grammar_data(const grammar& x) noexcept;
+        friend void internal::bind_predictors(grammar& x, internal::pt_predictor lpr_predictor, internal::pt_predictor ppr_predictor) noexcept;
 
 
         // internal, do not use
@@ -305,6 +321,26 @@ namespace taul {
         }
 
 
+        // image serializes the grammar into a binary image, which encodes the
+        // same data as serialize, but w/out being base64 encoded, making it
+        // smaller, and faster to load
+
+        // images are position independent, and so may be written to files,
+        // embedded in static arrays, memory mapped, etc.
+
+        std::vector<uint8_t> image() const;
+
+        // from_image attempts to generate a grammar from binary image x
+
+        // x is parsed into the grammar's own data structures, rather than the
+        // grammar referring to it, so x needs only to outlive the call (ie. a
+        // memory mapped file may be unmapped afterwards)
+
+        // from_image fails if x contains trailing bytes after the image
+
+        static std::optional<grammar> from_image(std::span<const uint8_t> x);
+
+
     private:
 
         std::shared_ptr<internal::grammar_data> _data;
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <span>
 
 #include "../general.h"
 #include "../asserts.h"
@@ -94,15 +95,22 @@ namespace taul::internal {
     };
 
 
+    // buff_reader reads from a span of bytes, rather than a buff, so that data
+    // can be read in-place from memory not owned by a buff (eg. a static array,
+    // or a memory mapped file), w/ the bytes needing to outlive the buff_reader
+
     struct buff_reader final {
-        const buff* target = nullptr;
+        std::span<const uint8_t> target;
         size_t offset = 0;
 
 
-        inline buff_reader(const buff& target, size_t offset = 0)
-            : target(&target),
+        inline buff_reader(std::span<const uint8_t> target, size_t offset = 0)
+            : target(target),
             offset(offset) {}
 
+        inline buff_reader(const buff& target, size_t offset = 0)
+            : buff_reader(std::span<const uint8_t>(target.data(), target.size()), offset) {}
+
         buff_reader() = delete;
         buff_reader(const buff_reader&) = default;
         buff_reader(buff_reader&&) noexcept = default;
@@ -131,8 +139,8 @@ namespace taul::internal {
         // returns number of bytes remaining until end of buffer
 
         inline size_t remaining() const noexcept {
-            TAUL_ASSERT(offset <= deref_assert(target).size());
-            return deref_assert(target).size() - offset;
+            TAUL_ASSERT(offset <= target.size());
+            return target.size() - offset;
         }
 
 
@@ -210,14 +218,14 @@ namespace taul::internal {
         inline std::optional<T> _next_one() noexcept {
             if (remaining() < sizeof(T)) return std::nullopt;
             T result{};
-            copy_bytes((const uint8_t*)deref_assert(target).data() + offset, sizeof(T), (uint8_t*)&result);
+            copy_bytes(target.data() + offset, sizeof(T), (uint8_t*)&result);
             offset += sizeof(T);
             return from_little_endian(result); // ensure portability
         }
 
         inline std::optional<std::span<const uint8_t>> _next_span(size_t n) noexcept {
             if (remaining() < n) return std::nullopt;
-            const auto result = std::span<const uint8_t>((const uint8_t*)deref_assert(target).data() + offset, n);
+            const auto result = target.subspan(offset, n);
             offset += n;
             return result;
         }
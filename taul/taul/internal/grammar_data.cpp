@@ -77,9 +77,11 @@ void taul::internal::grammar_data::build_lookup() {
 }
 
 void taul::internal::grammar_data::serialize(buff& b) const {
-    // TODO: the size_t(0) below is the TAUL internal API serialization version number, so that in the future
-    //       we can impl replacements for how serialization works w/out necessarily breaking existing usages
-    b.write(size_t(1), _lprs.size(), _pprs.size());
+    // serialization_version is the TAUL internal API serialization version number, so that we can impl
+    // replacements for how serialization works w/out necessarily breaking existing usages
+
+    // version 1 serialized only the rules of parse tables, w/ version 2 serializing them fully
+    b.write(serialization_version, _lprs.size(), _pprs.size());
     for (const auto& I : _lprs) I.serialize(b);
     for (const auto& I : _pprs) I.serialize(b);
     _lpr_pt.serialize(b);
@@ -90,7 +92,7 @@ std::optional<taul::internal::grammar_data> taul::internal::grammar_data::deseri
     auto rdr = b.fork();
     std::optional<grammar_data> result{};
     if (const auto aa = rdr.read<size_t, size_t, size_t>()) {
-        // TODO: internal_api_version is what's described in the TODO in stated in serialize
+        // internal_api_version is what's described in serialize
         const auto& [internal_api_version, expected_lprs, expected_pprs] = *aa;
 #if _DUMP_DESERIALIZE_LOG
         taul::log(make_stderr_logger(), "grammar_data::deserialize -> internal_api_version: {}, expected_lprs: {}, expected_pprs: {}", internal_api_version, expected_lprs, expected_pprs);
@@ -122,14 +124,14 @@ std::optional<taul::internal::grammar_data> taul::internal::grammar_data::deseri
         }
         temp._lpr_id_allocs.first_helper_id = lpr_id(expected_lprs);
         temp._ppr_id_allocs.first_helper_id = ppr_id(expected_pprs);
-        if (auto lpr_pt = parse_table<glyph>::deserialize(rdr)) temp._lpr_pt = std::move(*lpr_pt);
+        if (auto lpr_pt = parse_table<glyph>::deserialize(rdr, internal_api_version)) temp._lpr_pt = std::move(*lpr_pt);
         else {
 #if _DUMP_DESERIALIZE_LOG
             log(make_stderr_logger(), "grammar_data::deserialize -> failed! (lexer parse_table not found)");
 #endif
             return std::nullopt;
         }
-        if (auto ppr_pt = parse_table<token>::deserialize(rdr)) temp._ppr_pt = std::move(*ppr_pt);
+        if (auto ppr_pt = parse_table<token>::deserialize(rdr, internal_api_version)) temp._ppr_pt = std::move(*ppr_pt);
         else {
 #if _DUMP_DESERIALIZE_LOG
             log(make_stderr_logger(), "grammar_data::deserialize -> failed! (parser parse_table not found)");
@@ -66,6 +66,11 @@ namespace taul::internal {
         void build_lookup();
 
 
+        // serialization_version is the TAUL internal API serialization version
+        // number written by serialize (see serialize)
+
+        static constexpr size_t serialization_version = 2;
+
         void serialize(buff& b) const;
 
         static std::optional<grammar_data> deserialize(buff_reader& b);
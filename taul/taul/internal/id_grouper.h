@@ -4,6 +4,8 @@
 
 
 #include <vector>
+#include <span>
+#include <algorithm>
 
 #include "../asserts.h"
 #include "../symbol_id.h"
@@ -39,6 +41,16 @@ namespace taul::internal {
     using group_id = symbol_id_num;
 
 
+    // group_span is an inclusive range of group IDs, which the ID grouper
+    // maps a use case to
+
+    struct group_span final {
+        group_id low, high;
+
+        constexpr bool operator==(const group_span&) const noexcept = default;
+    };
+
+
     template<typename Symbol>
     class id_grouper final {
     public:
@@ -49,6 +61,13 @@ namespace taul::internal {
         //          * invalidates all current group IDs
         //          * all use cases should be specified before proper usage of
         //            the group ID space may begin
+        //      void add_use_cases(std::span<const symbol_range<Symbol>> x)
+        //          * equiv to calling add_use_case for each element of x, but
+        //            in O(n log n) time, rather than O(n^2)
+        //      group_span get_group_span(symbol_id low, symbol_id high) const noexcept
+        //          * returns the span of group IDs which use case [low, high] maps to
+        //          * [low, high] must be a use case added to the ID grouper, or
+        //            a contiguous union of them
         //      group_id get_group_id(symbol_id x) const noexcept
         //          * returns the group ID x is mapped to
         //          * all values of x must be mappable
@@ -106,6 +125,31 @@ namespace taul::internal {
             }
         }
 
+        // add_use_cases collects the IDs at which groups must begin, sorts and dedups
+        // them, and then rebuilds ranges from them in a single pass, so large charsets
+        // (ie. Unicode identifier classes) don't make grouper population quadratic
+
+        inline void add_use_cases(std::span<const symbol_range_t> x) {
+            std::vector<symbol_id> starts{};
+            starts.reserve(ranges.size() + x.size() * 2);
+            for (const auto& I : ranges) starts.push_back(I.low);
+            for (const auto& I : x) {
+                TAUL_ASSERT(traits_t::legal_id(I.low));
+                TAUL_ASSERT(traits_t::legal_id(I.high));
+                TAUL_ASSERT(I.low <= I.high);
+                starts.push_back(I.low);
+                if (I.high != traits_t::last_id) starts.push_back(I.high + 1);
+            }
+            std::sort(starts.begin(), starts.end());
+            starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+            ranges.clear();
+            ranges.reserve(starts.size());
+            for (std::size_t i = 0; i < starts.size(); i++) {
+                const auto high = i + 1 < starts.size() ? starts[i + 1] - 1 : traits_t::last_id;
+                ranges.push_back(symbol_range_t{ starts[i], high });
+            }
+        }
+
         inline group_id get_group_id(symbol_id x) const noexcept {
             TAUL_ASSERT(traits_t::legal_id(x));
             return _find(x, 0, ranges.size());
@@ -118,6 +162,14 @@ namespace taul::internal {
             return ranges[x];
         }
 
+        inline group_span get_group_span(symbol_id low, symbol_id high) const noexcept {
+            TAUL_ASSERT(low <= high);
+            const group_span result{ get_group_id(low), get_group_id(high) };
+            TAUL_ASSERT(ranges[result.low].low == low);
+            TAUL_ASSERT(ranges[result.high].high == high);
+            return result;
+        }
+
 
     private:
 
@@ -199,6 +251,31 @@ namespace taul::internal {
             }
         }
 
+        // add_use_cases collects the IDs at which groups must begin, sorts and dedups
+        // them, and then rebuilds ranges from them in a single pass, so large charsets
+        // (ie. Unicode identifier classes) don't make grouper population quadratic
+
+        inline void add_use_cases(std::span<const symbol_range_t> x) {
+            std::vector<symbol_id> starts{};
+            starts.reserve(ranges.size() + x.size() * 2);
+            for (const auto& I : ranges) starts.push_back(I.low);
+            for (const auto& I : x) {
+                TAUL_ASSERT(traits_t::legal_id(I.low));
+                TAUL_ASSERT(traits_t::legal_id(I.high));
+                TAUL_ASSERT(I.low <= I.high);
+                starts.push_back(I.low);
+                if (I.high != traits_t::last_id) starts.push_back(I.high + 1);
+            }
+            std::sort(starts.begin(), starts.end());
+            starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+            ranges.clear();
+            ranges.reserve(starts.size());
+            for (std::size_t i = 0; i < starts.size(); i++) {
+                const auto high = i + 1 < starts.size() ? starts[i + 1] - 1 : traits_t::last_id;
+                ranges.push_back(symbol_range_t{ starts[i], high });
+            }
+        }
+
         inline group_id get_group_id(symbol_id x) const noexcept {
             TAUL_ASSERT(traits_t::legal_id(x));
             return _find(x, 0, ranges.size());
@@ -211,6 +288,14 @@ namespace taul::internal {
             return ranges[x];
         }
 
+        inline group_span get_group_span(symbol_id low, symbol_id high) const noexcept {
+            TAUL_ASSERT(low <= high);
+            const group_span result{ get_group_id(low), get_group_id(high) };
+            TAUL_ASSERT(ranges[result.low].low == low);
+            TAUL_ASSERT(ranges[result.high].high == high);
+            return result;
+        }
+
 
     private:
 
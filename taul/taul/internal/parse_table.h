@@ -3,15 +3,21 @@
 #pragma once
 
 
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <tuple>
 #include <variant>
 #include <unordered_set>
 #include <unordered_map>
 
 #include "../hashing.h"
+#include "../grammar.h"
 #include "../symbol_range.h"
 #include "../symbol_set.h"
 
 #include "id_grouper.h"
+#include "recovery_set.h"
 #include "buff.h"
 
 
@@ -745,6 +751,18 @@ namespace taul::internal {
         std::unordered_map<symbol_id, symbol_set<Symbol>> follow_sets_A;
         std::unordered_map<symbol_id, symbol_set<Symbol>> prefix_sets_A;
 
+        // these are bitsets of the prefix sets of each non-terminal, indexed by
+        // non-terminal ID (relative to first_nonterminal_id), used to speed up
+        // parser error recovery, w/ these only being built for token tables
+
+        std::vector<recovery_set> recovery_sets;
+
+        // this is an optional direct-coded replacement for lookup via grouper/mappings,
+        // w/ this not being serialized, instead being bound upon loading a grammar
+        // by the fetcher which generated it (see export_fetcher)
+
+        pt_predictor predictor = nullptr;
+
 
         // add_rule adds new rules to the end of the parse table's rule vector
 
@@ -771,6 +789,30 @@ namespace taul::internal {
 
         inline parse_table<Symbol>& build_mappings(parse_table_build_details<Symbol>& details);
 
+        // optimize rewrites the parse table's rules into an equivalent form w/ fewer,
+        // larger, rules, so that the parsing system takes fewer steps per input symbol
+
+        // optimize is to be called prior to build_mappings, w/ first_helper_id being
+        // the boundary between main and helper non-terminal IDs (see nonterminal_id_alloc),
+        // w/ main non-terminals never being removed
+
+        // optimize performs the following, in order:
+        //      1) alternatives which are each a single terminal, w/ ID ranges which are
+        //         adjacent (ie. not overlapping), are merged into a single alternative
+        //      2) helpers w/ a single alternative are inlined into the rules referencing
+        //         them, w/ this including helpers whose only alternative is empty
+        //      3) rules of non-terminals unreachable from a main non-terminal are removed
+
+        // for token tables, #2 is limited to nullable helpers, as lookup of these cannot
+        // fail, as helper lookup failure is reported to the parser's listener as a
+        // non-terminal error, which inlining would otherwise turn into a terminal error
+
+        // optimize never introduces ambiguity, nor left-recursion, however it may alter
+        // the diagnostics of existing ones, so if build_mappings reports errors, the
+        // diagnostics to report should come from building the unoptimized rules
+
+        inline parse_table<Symbol>& optimize(symbol_id first_helper_id);
+
 
     private:
 
@@ -786,6 +828,7 @@ namespace taul::internal {
         inline void _populate_id_grouper(parse_table_build_details<Symbol>& details);
         inline void _populate_parse_table_and_check_for_collisions(parse_table_build_details<Symbol>& details);
         inline void _move_assign_first_follow_and_prefix_sets(parse_table_build_details<Symbol>& details);
+        inline void _build_recovery_sets();
 
 
     public:
@@ -799,51 +842,42 @@ namespace taul::internal {
         inline std::optional<size_t> lookup(const pt_key& k) const noexcept;
         inline std::optional<size_t> lookup(symbol_id nonterminal, group_id terminal_group) const noexcept;
 
+        // fetch_recovery_set returns the recovery set of nonterminal, if any
+
+        // fetch_recovery_set behaviour is undefined prior to build_mappings being called
+
+        inline const recovery_set* fetch_recovery_set(symbol_id nonterminal) const noexcept;
+
 
         inline std::string fmt(const char* tab = "    ") const;
 
 
-        inline void serialize(buff& b) const {
-            b.write(rules.size());
-            for (const auto& I : rules) I.serialize(b);
-        }
+        // serialize writes the parse table to b, including not just its rules, but also
+        // its ID grouper, mappings, and FIRST/FOLLOW/prefix sets, so that deserialize
+        // need not rebuild them
 
-        static inline std::optional<parse_table<Symbol>> deserialize(buff_reader& b) {
-            auto rdr = b.fork();
-            std::optional<parse_table<Symbol>> result{};
-            if (const auto aa = rdr.read<size_t>()) {
-                const auto& [expected_rules] = *aa;
-#if _TAUL_PT_DUMP_DESERIALIZE_LOG
-                log(make_stderr_logger(), "parse_table<...>::deserialize -> expected_rules: {}", expected_rules);
-#endif
-                parse_table<Symbol> temp{};
-                for (size_t i = 0; i < expected_rules; i++) {
-                    if (auto x = pt_rule<Symbol>::deserialize(rdr)) {
-                        temp.rules.push_back(std::move(*x));
-                    }
-                    else {
-#if _TAUL_PT_DUMP_DESERIALIZE_LOG
-                        log(make_stderr_logger(), "parse_table<...>::deserialize -> failed! (expected rule not found)");
-#endif
-                        return std::nullopt;
-                    }
-                }
-                parse_table_build_details<Symbol> details; // we just discard this
-                temp.build_mappings(details);
-                // if didn't fail up to this point, assign result
-                result = std::move(temp);
-#if _TAUL_PT_DUMP_DESERIALIZE_LOG
-                log(make_stderr_logger(), "parse_table<...>::deserialize -> done!");
-#endif
-            }
-            if (result) b.commit(rdr);
-#if _TAUL_PT_DUMP_DESERIALIZE_LOG
-            else {
-                log(make_stderr_logger(), "parse_table<...>::deserialize -> failed!");
-            }
-#endif
-            return result;
-        }
+        // serialize behaviour is undefined prior to build_mappings being called
+
+        inline void serialize(buff& b) const;
+
+        // deserialize reads a parse table from b, w/ version being the internal API
+        // serialization version of the data (see grammar_data::serialize)
+
+        // version 1 data contains only rules, w/ build_mappings being called upon
+        // them, while version 2 data contains the full parse table, which is then
+        // merely validated, making loading linear in the size of the data
+
+        static inline std::optional<parse_table<Symbol>> deserialize(buff_reader& b, size_t version);
+
+
+    private:
+
+        using _sets_t = std::unordered_map<symbol_id, symbol_set<Symbol>>;
+
+        static inline void _serialize_sets(buff& b, const _sets_t& x);
+        static inline bool _deserialize_sets(buff_reader& b, _sets_t& x);
+        static inline bool _deserialize_ranges(buff_reader& b, std::vector<symbol_range<Symbol>>& x);
+        inline bool _deserialize_built(buff_reader& b);
     };
 
     template<typename Symbol>
@@ -902,6 +936,156 @@ namespace taul::internal {
         _populate_id_grouper(details);
         _populate_parse_table_and_check_for_collisions(details);
         _move_assign_first_follow_and_prefix_sets(details);
+        _build_recovery_sets();
+        return *this;
+    }
+
+    template<typename Symbol>
+    inline parse_table<Symbol>& parse_table<Symbol>::optimize(symbol_id first_helper_id) {
+        using term_t = pt_term<Symbol>;
+        // helpers whose inlined terms would exceed this are left alone, so nested
+        // kleene-plus exprs (which ref their helpers twice) can't blow up rule sizes
+        constexpr size_t max_inlined_terms = 64;
+
+        const auto is_helper = [&](symbol_id x) { return x >= first_helper_id; };
+
+        std::vector<bool> removed(rules.size(), false);
+        std::unordered_map<symbol_id, std::vector<size_t>> alts{}; // rule indices of each non-terminal
+        for (size_t i = 0; i < rules.size(); i++) alts[rules[i].id].push_back(i);
+
+        // 1) merge adjacent single terminal alternatives
+
+        // overlapping ranges are ambiguity, which must be left for build_mappings to detect
+
+        for (auto& [id, indices] : alts) {
+            std::vector<size_t> singles{};
+            for (const auto& I : indices) {
+                if (rules[I].terms.size() == 1 && rules[I].terms[0].is_terminal()) singles.push_back(I);
+            }
+            if (singles.size() < 2) continue;
+            std::sort(singles.begin(), singles.end(),
+                [&](size_t a, size_t b) {
+                    return rules[a].terms[0].terminal().ids.low < rules[b].terms[0].terminal().ids.low;
+                });
+            size_t run = singles[0];
+            for (size_t j = 1; j < singles.size(); j++) {
+                auto& run_terminal = rules[run].terms[0].terminal();
+                const auto& next_terminal = rules[singles[j]].terms[0].terminal();
+                const bool adjacent =
+                    run_terminal.assertion == next_terminal.assertion &&
+                    run_terminal.ids.high != symbol_traits<Symbol>::last_id &&
+                    next_terminal.ids.low == run_terminal.ids.high + 1;
+                if (adjacent) {
+                    run_terminal.ids.high = next_terminal.ids.high;
+                    removed[singles[j]] = true;
+                }
+                else run = singles[j];
+            }
+            std::erase_if(indices, [&](size_t i) { return removed[i]; });
+        }
+
+        // 2) inline single alternative helpers
+
+        std::unordered_set<symbol_id> nullable{};
+        if constexpr (std::is_same_v<Symbol, token>) {
+            // assertion terminals are treated as non-nullable, like in FIRST sets
+            const auto is_nullable_term =
+                [&](const term_t& x) {
+                if (x.is_terminal()) return false;
+                if (x.is_nonterminal()) return nullable.contains(x.nonterminal().id);
+                return true; // precedence predicates and pylons
+                };
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (size_t i = 0; i < rules.size(); i++) {
+                    if (removed[i] || nullable.contains(rules[i].id)) continue;
+                    if (!std::all_of(rules[i].terms.begin(), rules[i].terms.end(), is_nullable_term)) continue;
+                    nullable.insert(rules[i].id);
+                    changed = true;
+                }
+            }
+        }
+        std::unordered_map<symbol_id, size_t> inlinable{}; // maps helpers to their rule index
+        for (const auto& [id, indices] : alts) {
+            if (!is_helper(id) || indices.size() != 1) continue;
+            if constexpr (std::is_same_v<Symbol, token>) {
+                if (!nullable.contains(id)) continue;
+            }
+            const auto& terms = rules[indices[0]].terms;
+            const bool recursive =
+                std::any_of(terms.begin(), terms.end(),
+                    [&](const term_t& x) { return x.is_nonterminal() && x.nonterminal().id == id; });
+            if (!recursive) inlinable[id] = indices[0];
+        }
+        // refs to helpers w/ a precedence value other than signal_preced_val are left alone,
+        // as the inlined terms would otherwise propagate the wrong precedence value
+
+        // bodies memoizes the inlined terms of helpers, w/ visiting being the helpers
+        // currently being inlined, refs to which are left alone, so cycles of helpers
+        // terminate, leaving a ref to the helper which started the cycle
+
+        std::unordered_map<symbol_id, std::vector<term_t>> bodies{};
+        std::unordered_set<symbol_id> visiting{};
+        const auto expand =
+            [&](auto& self, const std::vector<term_t>& terms) -> std::vector<term_t> {
+            std::vector<term_t> result{};
+            result.reserve(terms.size());
+            for (const auto& I : terms) {
+                const bool candidate =
+                    I.is_nonterminal() &&
+                    I.nonterminal().preced_val == signal_preced_val &&
+                    inlinable.contains(I.nonterminal().id) &&
+                    !visiting.contains(I.nonterminal().id);
+                if (!candidate) {
+                    result.push_back(I);
+                    continue;
+                }
+                const symbol_id id = I.nonterminal().id;
+                if (!bodies.contains(id)) {
+                    visiting.insert(id);
+                    auto body = self(self, rules[inlinable.at(id)].terms);
+                    visiting.erase(id);
+                    bodies[id] = std::move(body);
+                }
+                const auto& body = bodies.at(id);
+                if (body.size() > max_inlined_terms) result.push_back(I);
+                else result.insert(result.end(), body.begin(), body.end());
+            }
+            return result;
+            };
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (!removed[i]) rules[i].terms = expand(expand, rules[i].terms);
+        }
+
+        // 3) remove unreachable rules
+
+        std::unordered_set<symbol_id> reachable{};
+        std::vector<symbol_id> pending{};
+        for (const auto& [id, indices] : alts) {
+            if (is_helper(id)) continue;
+            reachable.insert(id);
+            pending.push_back(id);
+        }
+        while (!pending.empty()) {
+            const auto it = alts.find(pending.back());
+            pending.pop_back();
+            if (it == alts.end()) continue; // <- ref to undefined non-terminal, which build_mappings will catch
+            for (const auto& I : it->second) {
+                for (const auto& J : rules[I].terms) {
+                    if (J.is_nonterminal() && reachable.insert(J.nonterminal().id).second) {
+                        pending.push_back(J.nonterminal().id);
+                    }
+                }
+            }
+        }
+        std::vector<pt_rule<Symbol>> result{};
+        result.reserve(rules.size());
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (removed[i] || !reachable.contains(rules[i].id)) continue;
+            result.push_back(std::move(rules[i]));
+        }
+        rules = std::move(result);
         return *this;
     }
 
@@ -954,83 +1138,158 @@ namespace taul::internal {
     
     template<typename Symbol>
     inline void taul::internal::parse_table<Symbol>::_build_first_sets(parse_table_build_details<Symbol>& details) {
-        details.first_sets_A.reserve(details.defined_nonterminals.size());
-        // ensure every rule has an associated FIRST set
-        for (const auto& I : details.defined_nonterminals) {
-            details.first_sets_A.try_emplace(I, symbol_set<Symbol>{});
-        }
-        details.first_sets_w.resize(rules.size());
+        using traits_t = symbol_traits<Symbol>;
 #if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
         TAUL_LOG(make_stderr_logger(), "building FIRST sets!");
 #endif
-        while (true) {
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-            TAUL_LOG(make_stderr_logger(), "*** cycle ***");
-#endif
-            bool changed = false;
-            for (size_t i = 0; i < rules.size(); i++) {
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                TAUL_LOG(make_stderr_logger(), "> rule {}", i);
-#endif
-                const auto& I = rules[i];
-                auto& set_A = details.first_sets_A[I.id];
-                auto& set_w = details.first_sets_w[i];
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                TAUL_LOG(make_stderr_logger(), "before:");
-                TAUL_LOG(make_stderr_logger(), "    set_A == {}", set_A);
-                TAUL_LOG(make_stderr_logger(), "    set_w == {}", set_w);
-#endif
+        // FIRST sets are unions of the ID ranges of terminals in rules, so we partition
+        // the ID space into 'atoms' via the endpoints of these ranges, and build FIRST
+        // sets as dense bitsets of atoms, w/ these only being converted into symbol
+        // sets once the build is complete
 
-                bool found_nonempty_term = false;
-                for (const auto& J : I.terms) {
-                    // add ID's of front terminal
-                    if (J.is_terminal()) {
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                        TAUL_LOG(make_stderr_logger(), "    -> adding {}", front.terminal().ids);
-#endif
-                        if (!set_w.includes_range(J.terminal().ids)) changed = true;
-                        set_w.add_range(J.terminal().ids);
+        std::vector<symbol_id> bounds{ traits_t::first_id }; // atom i starts at bounds[i]
+        for (const auto& I : rules) {
+            for (const auto& J : I.terms) {
+                if (!J.is_terminal()) continue;
+                bounds.push_back(J.terminal().ids.low);
+                if (J.terminal().ids.high < traits_t::last_id) bounds.push_back(J.terminal().ids.high + 1);
+            }
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+        const auto atom_of =
+            [&](symbol_id x) -> size_t {
+            return size_t(std::upper_bound(bounds.begin(), bounds.end(), x) - bounds.begin()) - 1;
+            };
+        const size_t words = (bounds.size() + 63) / 64;
 
-                        found_nonempty_term = true;
-                        break;
-                    }
-                    // add FIRST set of front non-terminal
-                    if (J.is_nonterminal()) {
-                        TAUL_ASSERT(details.first_sets_A.contains(J.nonterminal().id));
-                        const auto& J_first_set_A = details.first_sets_A.at(J.nonterminal().id);
-                        const auto other =
-                            symbol_set<Symbol>(J_first_set_A)
-                            .remove_epsilon(); // gotta remember to remove epsilon!
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                        TAUL_LOG(make_stderr_logger(), "    -> adding {}", other);
-#endif
-                        if (!set_w.includes_set(other)) changed = true;
-                        set_w.add_set(other);
+        // give non-terminals dense indices, w/ sets [0, nonterminals) being Fi(A)
+        // sets, and [nonterminals, nonterminals + rules.size()) being Fi(w) sets
 
-                        if (J_first_set_A.includes_epsilon()) continue;
-                        found_nonempty_term = true;
-                        break;
-                    }
+        std::unordered_map<symbol_id, size_t> nonterminal_index{};
+        nonterminal_index.reserve(details.defined_nonterminals.size());
+        for (const auto& I : details.defined_nonterminals) {
+            nonterminal_index.try_emplace(I, nonterminal_index.size());
+        }
+        const size_t nonterminals = nonterminal_index.size();
+        std::vector<std::uint64_t> bits((nonterminals + rules.size()) * words, 0);
+        std::vector<std::uint8_t> epsilon(nonterminals + rules.size(), 0);
+        const auto set_bits =
+            [&](size_t set) -> std::span<std::uint64_t> {
+            return std::span(bits).subspan(set * words, words);
+            };
+
+        // translate rules' terms into atom spans/non-terminal indices up-front, and
+        // record which rules use each non-terminal, so that we need only revisit
+        // rules when the FIRST set of a non-terminal they use changes
+
+        struct term_t final {
+            bool terminal;
+            size_t low, high; // atom span if terminal, else low is non-terminal index
+        };
+        std::vector<std::vector<term_t>> terms(rules.size());
+        std::vector<size_t> owners(rules.size());
+        std::vector<std::vector<size_t>> users(nonterminals);
+        for (size_t i = 0; i < rules.size(); i++) {
+            owners[i] = nonterminal_index.at(rules[i].id);
+            for (const auto& J : rules[i].terms) {
+                if (J.is_terminal()) {
+                    terms[i].push_back(term_t{ true, atom_of(J.terminal().ids.low), atom_of(J.terminal().ids.high) });
                 }
-                if (!found_nonempty_term) {
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                    TAUL_LOG(make_stderr_logger(), "    -> adding epsilon");
-#endif
-                    if (!set_w.includes_epsilon()) changed = true;
-                    set_w.add_epsilon();
+                else if (J.is_nonterminal()) {
+                    TAUL_ASSERT(nonterminal_index.contains(J.nonterminal().id));
+                    const size_t index = nonterminal_index.at(J.nonterminal().id);
+                    terms[i].push_back(term_t{ false, index, index });
+                    users[index].push_back(i);
                 }
+            }
+        }
 
-                // add latest from set_w to set_A
-                set_A.add_set(set_w);
-#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
-                TAUL_LOG(make_stderr_logger(), "after:");
-                TAUL_LOG(make_stderr_logger(), "    set_A == {}", set_A);
-                TAUL_LOG(make_stderr_logger(), "    set_w == {}", set_w);
-#endif
+        // merge_into ORs src into dst, returning if dst changed
+
+        const auto merge_into =
+            [](std::span<std::uint64_t> dst, std::span<const std::uint64_t> src) -> bool {
+            bool changed = false;
+            for (size_t i = 0; i < dst.size(); i++) {
+                changed |= (src[i] & ~dst[i]) != 0;
+                dst[i] |= src[i];
+            }
+            return changed;
+            };
+
+        std::vector<size_t> worklist(rules.size());
+        std::vector<std::uint8_t> queued(rules.size(), 1);
+        for (size_t i = 0; i < rules.size(); i++) worklist[i] = rules.size() - 1 - i; // <- visit rules in order
+        std::vector<std::uint64_t> temp(words);
+        while (!worklist.empty()) {
+            const size_t i = worklist.back();
+            worklist.pop_back();
+            queued[i] = 0;
+            // compute Fi(w) from the current FIRST sets of its terms
+            std::fill(temp.begin(), temp.end(), 0);
+            bool temp_epsilon = true;
+            for (const auto& J : terms[i]) {
+                if (J.terminal) {
+                    for (size_t k = J.low; k <= J.high; k++) temp[k / 64] |= std::uint64_t(1) << (k % 64);
+                    temp_epsilon = false;
+                    break;
+                }
+                merge_into(temp, set_bits(J.low));
+                if (epsilon[J.low]) continue;
+                temp_epsilon = false;
+                break;
+            }
+            const size_t set_w = nonterminals + i;
+            bool changed = merge_into(set_bits(set_w), temp);
+            if (temp_epsilon && !epsilon[set_w]) {
+                epsilon[set_w] = 1;
+                changed = true;
+            }
+            if (!changed) continue;
+            // add latest from Fi(w) to Fi(A), revisiting its users if it changed
+            const size_t set_A = owners[i];
+            bool changed_A = merge_into(set_bits(set_A), set_bits(set_w));
+            if (epsilon[set_w] && !epsilon[set_A]) {
+                epsilon[set_A] = 1;
+                changed_A = true;
+            }
+            if (!changed_A) continue;
+            for (const auto& user : users[set_A]) {
+                if (queued[user]) continue;
+                queued[user] = 1;
+                worklist.push_back(user);
             }
-            // keep looping until FIRST sets stop changing
-            if (!changed) break;
         }
+
+        // convert our bitsets into symbol sets
+
+        const auto to_symbol_set =
+            [&](size_t set) -> symbol_set<Symbol> {
+            symbol_set<Symbol> result{};
+            const auto x = set_bits(set);
+            const auto has = [&](size_t k) { return (x[k / 64] >> (k % 64)) & 1; };
+            for (size_t k = 0; k < bounds.size(); k++) {
+                if (!has(k)) continue;
+                const size_t start = k;
+                while (k + 1 < bounds.size() && has(k + 1)) k++;
+                const symbol_id high = k + 1 < bounds.size() ? bounds[k + 1] - 1 : traits_t::last_id;
+                result.add_id_range(bounds[start], high);
+            }
+            if (epsilon[set]) result.add_epsilon();
+            return result;
+            };
+        details.first_sets_A.reserve(nonterminals);
+        for (const auto& [id, index] : nonterminal_index) {
+            details.first_sets_A.try_emplace(id, to_symbol_set(index));
+        }
+        details.first_sets_w.reserve(rules.size());
+        for (size_t i = 0; i < rules.size(); i++) {
+            details.first_sets_w.push_back(to_symbol_set(nonterminals + i));
+        }
+#if _TAUL_PT_DUMP_FIRST_SET_BUILD_PROCESS_LOG
+        for (const auto& [id, set] : details.first_sets_A) TAUL_LOG(make_stderr_logger(), "Fi({}) == {}", id, set);
+        for (size_t i = 0; i < rules.size(); i++) TAUL_LOG(make_stderr_logger(), "Fi(w) (rule {}) == {}", i, details.first_sets_w[i]);
+#endif
     }
 
     template<typename Symbol>
@@ -1163,30 +1422,28 @@ namespace taul::internal {
     
     template<typename Symbol>
     inline void taul::internal::parse_table<Symbol>::_populate_id_grouper(parse_table_build_details<Symbol>& details) {
+        // gather all use cases first, then add them in bulk, as adding them one-by-one
+        // is quadratic in the number of ranges (ie. for large Unicode charsets)
+        std::vector<symbol_range<Symbol>> use_cases{};
         for (const auto& I : details.first_sets_A) {
 #if _TAUL_PT_DUMP_PARSE_TABLE_USE_CASE_ADDING_LOG
             TAUL_LOG(make_stderr_logger(), "    > adding from Fi(A) {} (of {})", I.second, I.first);
 #endif
-            for (const auto& J : I.second.ranges()) {
-                grouper.add_use_case(J.low, J.high);
-            }
+            use_cases.insert(use_cases.end(), I.second.ranges().begin(), I.second.ranges().end());
         }
         for (const auto& I : details.follow_sets_A) {
 #if _TAUL_PT_DUMP_PARSE_TABLE_USE_CASE_ADDING_LOG
             TAUL_LOG(make_stderr_logger(), "    > adding from Fo(A) {} (of {})", I.second, I.first);
 #endif
-            for (const auto& J : I.second.ranges()) {
-                grouper.add_use_case(J.low, J.high);
-            }
+            use_cases.insert(use_cases.end(), I.second.ranges().begin(), I.second.ranges().end());
         }
         for (const auto& I : details.first_sets_w) {
 #if _TAUL_PT_DUMP_PARSE_TABLE_USE_CASE_ADDING_LOG
             TAUL_LOG(make_stderr_logger(), "    > adding from Fi(w) {}", I);
 #endif
-            for (const auto& J : I.ranges()) {
-                grouper.add_use_case(J.low, J.high);
-            }
+            use_cases.insert(use_cases.end(), I.ranges().begin(), I.ranges().end());
         }
+        grouper.add_use_cases(use_cases);
     }
     
     template<typename Symbol>
@@ -1206,13 +1463,12 @@ namespace taul::internal {
             group_id minimum_group = 0;
 
             for (const auto& J : prefix_set_w.ranges()) {
-                const group_id low_group = grouper(J.low);
-                const group_id high_group = grouper(J.high);
+                const group_span span = grouper.get_group_span(J.low, J.high);
 
-                TAUL_ASSERT(low_group >= minimum_group);
-                minimum_group = high_group + 1;
+                TAUL_ASSERT(span.low >= minimum_group);
+                minimum_group = span.high + 1;
 
-                for (group_id ii = low_group; ii <= high_group; ii++) {
+                for (group_id ii = span.low; ii <= span.high; ii++) {
                     pt_key key{ I.id, ii };
                     if (!mappings.contains(key)) {
                         mappings[key] = i;
@@ -1225,6 +1481,25 @@ namespace taul::internal {
         }
     }
 
+    template<typename Symbol>
+    inline void parse_table<Symbol>::_build_recovery_sets() {
+        recovery_sets.clear();
+        // glyph tables are used only by the lexer, which has no error recovery
+        if constexpr (std::is_same_v<Symbol, token>) {
+            std::vector<token_range> all_ranges{};
+            for (const auto& [id, set] : prefix_sets_A) {
+                all_ranges.insert(all_ranges.end(), set.ranges().begin(), set.ranges().end());
+            }
+            const size_t width = recovery_set_width(all_ranges);
+            if (width > max_recovery_set_width) return;
+            for (const auto& [id, set] : prefix_sets_A) {
+                const size_t index = size_t(id) - size_t(symbol_traits<Symbol>::first_nonterminal_id);
+                if (index >= recovery_sets.size()) recovery_sets.resize(index + 1);
+                recovery_sets[index] = recovery_set(width, set.ranges());
+            }
+        }
+    }
+
     template<typename Symbol>
     inline void parse_table<Symbol>::_move_assign_first_follow_and_prefix_sets(parse_table_build_details<Symbol>& details) {
         std::swap(first_sets_A, details.first_sets_A);
@@ -1246,6 +1521,15 @@ namespace taul::internal {
         return lookup(pt_key{ nonterminal, terminal_group });
     }
 
+    template<typename Symbol>
+    inline const recovery_set* parse_table<Symbol>::fetch_recovery_set(symbol_id nonterminal) const noexcept {
+        const size_t index = size_t(nonterminal) - size_t(symbol_traits<Symbol>::first_nonterminal_id);
+        return
+            index < recovery_sets.size()
+            ? &recovery_sets[index]
+            : nullptr;
+    }
+
     template<typename Symbol>
     inline std::string taul::internal::parse_table<Symbol>::fmt(const char* tab) const {
         TAUL_ASSERT(tab);
@@ -1281,5 +1565,188 @@ namespace taul::internal {
         }
         return result;
     }
+
+    template<typename Symbol>
+    inline void parse_table<Symbol>::serialize(buff& b) const {
+        b.write(rules.size());
+        for (const auto& I : rules) I.serialize(b);
+        b.write(grouper.ranges.size());
+        for (const auto& I : grouper.ranges) b.write(I.low, I.high);
+        // sort mappings so output is deterministic, and so runs of groups of a non-terminal 
+        // which map to the same rule can be written as one entry, as they're very common 
+        // (ie. lexer rules spanning many glyph groups)
+        std::vector<std::pair<pt_key, size_t>> sorted_mappings(mappings.begin(), mappings.end());
+        std::sort(sorted_mappings.begin(), sorted_mappings.end(),
+            [](const auto& a, const auto& b) {
+                return std::tie(a.first.nonterminal, a.first.terminal_group) < std::tie(b.first.nonterminal, b.first.terminal_group);
+            });
+        struct run final {
+            symbol_id nonterminal;
+            group_id low, high;
+            uint32_t rule;
+        };
+        std::vector<run> runs{};
+        for (const auto& [k, v] : sorted_mappings) {
+            TAUL_ASSERT(v <= std::numeric_limits<uint32_t>::max());
+            if (!runs.empty()) {
+                auto& last = runs.back();
+                if (last.nonterminal == k.nonterminal && last.high + 1 == k.terminal_group && last.rule == uint32_t(v)) {
+                    last.high = k.terminal_group;
+                    continue;
+                }
+            }
+            runs.push_back(run{ k.nonterminal, k.terminal_group, k.terminal_group, uint32_t(v) });
+        }
+        b.write(runs.size());
+        for (const auto& I : runs) b.write(I.nonterminal, I.low, I.high, I.rule);
+        _serialize_sets(b, first_sets_A);
+        _serialize_sets(b, follow_sets_A);
+        _serialize_sets(b, prefix_sets_A);
+    }
+
+    template<typename Symbol>
+    inline std::optional<parse_table<Symbol>> parse_table<Symbol>::deserialize(buff_reader& b, size_t version) {
+        if (version != 1 && version != 2) {
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+            log(make_stderr_logger(), "parse_table<...>::deserialize -> failed! (unknown version {})", version);
+#endif
+            return std::nullopt;
+        }
+        auto rdr = b.fork();
+        std::optional<parse_table<Symbol>> result{};
+        if (const auto aa = rdr.read<size_t>()) {
+            const auto& [expected_rules] = *aa;
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+            log(make_stderr_logger(), "parse_table<...>::deserialize -> expected_rules: {}", expected_rules);
+#endif
+            parse_table<Symbol> temp{};
+            for (size_t i = 0; i < expected_rules; i++) {
+                if (auto x = pt_rule<Symbol>::deserialize(rdr)) {
+                    temp.rules.push_back(std::move(*x));
+                }
+                else {
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+                    log(make_stderr_logger(), "parse_table<...>::deserialize -> failed! (expected rule not found)");
+#endif
+                    return std::nullopt;
+                }
+            }
+            if (version == 1) {
+                parse_table_build_details<Symbol> details; // we just discard this
+                temp.build_mappings(details);
+            }
+            else if (!temp._deserialize_built(rdr)) {
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+                log(make_stderr_logger(), "parse_table<...>::deserialize -> failed! (malformed grouper/mappings/sets)");
+#endif
+                return std::nullopt;
+            }
+            // if didn't fail up to this point, assign result
+            result = std::move(temp);
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+            log(make_stderr_logger(), "parse_table<...>::deserialize -> done!");
+#endif
+        }
+        if (result) b.commit(rdr);
+#if _TAUL_PT_DUMP_DESERIALIZE_LOG
+        else {
+            log(make_stderr_logger(), "parse_table<...>::deserialize -> failed!");
+        }
+#endif
+        return result;
+    }
+
+    template<typename Symbol>
+    inline void parse_table<Symbol>::_serialize_sets(buff& b, const _sets_t& x) {
+        // sort by ID so output is deterministic
+        std::vector<symbol_id> ids{};
+        ids.reserve(x.size());
+        for (const auto& I : x) ids.push_back(I.first);
+        std::sort(ids.begin(), ids.end());
+        b.write(ids.size());
+        for (const auto& id : ids) {
+            const auto& set = x.at(id);
+            b.write(id, uint8_t(set.includes_epsilon()), set.ranges().size());
+            for (const auto& I : set.ranges()) b.write(I.low, I.high);
+        }
+    }
+
+    template<typename Symbol>
+    inline bool parse_table<Symbol>::_deserialize_sets(buff_reader& b, _sets_t& x) {
+        const auto aa = b.read<size_t>();
+        if (!aa) return false;
+        const auto& [expected_sets] = *aa;
+        if (expected_sets > b.remaining()) return false; // <- guard against garbage sizes
+        x.reserve(expected_sets);
+        std::vector<symbol_range<Symbol>> ranges{};
+        for (size_t i = 0; i < expected_sets; i++) {
+            const auto bb = b.read<symbol_id, uint8_t>();
+            if (!bb) return false;
+            const auto& [id, epsilon] = *bb;
+            if (!_deserialize_ranges(b, ranges)) return false;
+            // ranges must be in ascending order, w/ gaps between them
+            for (size_t j = 1; j < ranges.size(); j++) {
+                if (ranges[j].low <= ranges[j - 1].high + 1) return false;
+            }
+            symbol_set<Symbol> set{};
+            for (const auto& I : ranges) set.add_id_range(I.low, I.high);
+            if (epsilon != 0) set.add_epsilon();
+            if (!x.try_emplace(id, std::move(set)).second) return false;
+        }
+        return true;
+    }
+
+    template<typename Symbol>
+    inline bool parse_table<Symbol>::_deserialize_ranges(buff_reader& b, std::vector<symbol_range<Symbol>>& x) {
+        using traits_t = symbol_traits<Symbol>;
+        x.clear();
+        const auto aa = b.read<size_t>();
+        if (!aa) return false;
+        const auto& [expected_ranges] = *aa;
+        if (expected_ranges > b.remaining()) return false; // <- guard against garbage sizes
+        x.reserve(expected_ranges);
+        for (size_t i = 0; i < expected_ranges; i++) {
+            const auto bb = b.read<symbol_id, symbol_id>();
+            if (!bb) return false;
+            const auto& [low, high] = *bb;
+            if (!traits_t::legal_id(low) || !traits_t::legal_id(high) || low > high) return false;
+            x.push_back(symbol_range<Symbol>{ low, high });
+        }
+        return true;
+    }
+
+    template<typename Symbol>
+    inline bool parse_table<Symbol>::_deserialize_built(buff_reader& b) {
+        using traits_t = symbol_traits<Symbol>;
+        // grouper ranges must partition the symbol ID space
+        std::vector<symbol_range<Symbol>> ranges{};
+        if (!_deserialize_ranges(b, ranges) || ranges.empty()) return false;
+        if (ranges.front().low != traits_t::first_id || ranges.back().high != traits_t::last_id) return false;
+        for (size_t i = 1; i < ranges.size(); i++) {
+            if (ranges[i].low != ranges[i - 1].high + 1) return false;
+        }
+        grouper.ranges = std::move(ranges);
+        // mappings must map to rules of their non-terminal
+        const auto aa = b.read<size_t>();
+        if (!aa) return false;
+        const auto& [expected_runs] = *aa;
+        if (expected_runs > b.remaining()) return false; // <- guard against garbage sizes
+        mappings.reserve(expected_runs);
+        for (size_t i = 0; i < expected_runs; i++) {
+            const auto bb = b.read<symbol_id, group_id, group_id, uint32_t>();
+            if (!bb) return false;
+            const auto& [nonterminal, low, high, rule] = *bb;
+            if (low > high || high >= grouper.ranges.size()) return false;
+            if (rule >= rules.size() || rules[rule].id != nonterminal) return false;
+            for (group_id j = low; j <= high; j++) {
+                if (!mappings.try_emplace(pt_key{ nonterminal, j }, size_t(rule)).second) return false;
+            }
+        }
+        if (!_deserialize_sets(b, first_sets_A)) return false;
+        if (!_deserialize_sets(b, follow_sets_A)) return false;
+        if (!_deserialize_sets(b, prefix_sets_A)) return false;
+        _build_recovery_sets();
+        return true;
+    }
 }
 
@@ -3,8 +3,11 @@
 #pragma once
 
 
+#include "../grammar.h"
+
 #include "nonterminal_id_alloc.h"
 #include "parse_table.h"
+#include "grammar_data.h"
 
 
 #define _DUMP_LEXER_PARSING_SYSTEM_LOG 0
@@ -25,13 +28,20 @@ namespace taul::internal {
     //          * the symbol type used (ie. glyph or token)
     //      using rule_ref_type = ...
     //          * either lpr_ref or ppr_ref
-    //      static const nonterminal_id_allocs<symbol_type>& fetch_ntia(grammar x)
+    //      static const nonterminal_id_allocs<symbol_type>& fetch_ntia(const grammar_data& x)
     //          * returns from x the current nonterminal_id_allocs to use
-    //      static const parse_table<symbol_type>& fetch_pt(grammar x)
+    //      static const parse_table<symbol_type>& fetch_pt(const grammar_data& x)
     //          * returns from x the correct parse_table to use
     //      symbol_type peek()
     //      symbol_type next()
     //          * these are used to query the input
+    //      bool input_ready()
+    //          * returns if the next input symbol is available to be queried
+    //          * if not, the system will *suspend*, rather than query it
+    //      bool input_complete()
+    //          * returns if all input symbols are available to be queried
+    //          * if not, upon an error the system will suspend, rather than
+    //            reporting it, so that error recovery may query input freely
     //      void reinit_output(rule_ref_type start_rule)
     //          * prepares output state for new round of parsing
     //      std::string fmt_output() const
@@ -45,6 +55,18 @@ namespace taul::internal {
     //      void output_nonterminal_end()
     //          * reports the begin/end of the scope of an output non-terminal
     //          * transparent helper non-terminals will not be output
+    //      bool try_reuse_nonterminal(symbol_id nonterminal, symbol_type input)
+    //          * lets the policy *reuse* prior output for a non-terminal, w/ the policy
+    //            consuming its input, and outputting the prior output, in place of the
+    //            system expanding it normally
+    //          * returns if the non-terminal was reused
+    //          * this is only called after a successful parse table lookup
+    //      bool try_defer_nonterminal(symbol_id nonterminal, symbol_type input)
+    //          * lets the policy *defer* parsing of a non-terminal, w/ the policy consuming
+    //            its input, and outputting a placeholder for it, in place of the system
+    //            expanding it normally
+    //          * returns if the non-terminal was deferred
+    //          * this is only called after a successful parse table lookup
     //      void output_terminal_error(symbol_range<symbol_type> ids, symbol_type input)
     //      void output_nonterminal_error(symbol_id id, symbol_type input)
     //          * reports errors arising w/ terminal/non-terminal symbols
@@ -58,6 +80,11 @@ namespace taul::internal {
     //      void eh_recovery_failed()
     //          * these invoke the error handler
     //          * eh_recovery_failed is called upon a failed recovery attempt
+    //      bool within_limits(size_t depth)
+    //          * returns if the system may continue, given the size of the parse stack,
+    //            being called once per iteration of the system's main loop
+    //          * if not, the system aborts, w/ the policy being responsible for marking
+    //            its output as aborted
 
     
     template<typename Policy>
@@ -68,6 +95,27 @@ namespace taul::internal {
         using rule_ref_type = typename Policy::rule_ref_type;
 
 
+    private:
+
+        struct _item;
+
+
+    public:
+
+        // snapshot captures the state of the parse stack, for use in
+        // impling checkpoints
+
+        // the system outputs to the policy only while in a consistent
+        // state, such that a snapshot taken during output_terminal, 
+        // output_nonterminal_begin or output_nonterminal_end captures
+        // the system's state as it'll be just after the output call
+
+        struct snapshot final {
+            std::vector<_item> stack;
+            size_t current_depth = 0;
+        };
+
+
         std::shared_ptr<logger> lgr;
 
 
@@ -81,6 +129,26 @@ namespace taul::internal {
         inline bool parse(rule_ref_type start_rule);
 
 
+        inline snapshot take_snapshot() const;
+        inline void restore_snapshot(const snapshot& x);
+
+        // resume continues parsing from the current state of the system,
+        // as it'd be after restore_snapshot, w/out the setup of parse, and
+        // w/out reporting output_startup
+
+        // resume only reports eh_startup if the last round of parsing has
+        // ended (ie. not when resuming after suspending)
+
+        inline bool resume();
+
+        // suspended returns if the last parse/resume call returned early, w/out
+        // finishing, due to the system suspending, awaiting further input
+
+        // suspended parsing is continued via resume
+
+        inline bool suspended() const noexcept;
+
+
         // this is used to impl eh_check for the parser
 
         inline bool check();
@@ -94,6 +162,12 @@ namespace taul::internal {
         Policy _policy; // the policy object
         grammar _gram; // the grammar being used
 
+        // the hot loop accesses the grammar via this non-owning pointer, rather
+        // than copying _gram, so as to avoid atomic refcount traffic on the
+        // grammar's shared state, which is shared w/ other threads
+
+        const grammar_data* _gramdat;
+
         // remember that this stack should be thought of as growing
         // from right-to-left, not left-to-right
 
@@ -130,6 +204,9 @@ namespace taul::internal {
 
         size_t _current_depth = 0;
 
+        bool _suspended = false; // if the last parse/resume call suspended
+        bool _eh_started = false; // if eh_startup has been called w/out a matching eh_shutdown
+
 
         inline std::optional<size_t> _lookup_in_pt(symbol_id nonterminal, symbol_id terminal) const;
 
@@ -175,18 +252,24 @@ namespace taul::internal {
         inline bool _match_pylon(const pt_pylon&);
         inline bool _match_term(const pt_term<symbol_type>& term);
 
+        inline bool _must_suspend(const pt_term<symbol_type>& term);
+
         inline bool _parse(rule_ref_type start_rule);
+        inline bool _resume();
+        inline bool _run();
 
 
         bool _check_is_for_terminal = true;
         symbol_range<symbol_type> _check_terminal_ids = {};
         symbol_id _check_nonterminal_id = {};
+        const recovery_set* _check_recovery_set = nullptr; // the recovery set of _check_nonterminal_id, if any
 
 
         inline void _bind_check_for_terminal(const pt_terminal<symbol_type>& terminal);
         inline void _bind_check_for_nonterminal(const pt_nonterminal& nonterminal);
 
         inline bool _check();
+        inline bool _check_nonterminal(symbol_id input) const;
 
 
         inline void _debug_transparent_nonterminal();
@@ -202,7 +285,8 @@ namespace taul::internal {
     inline taul::internal::parsing_system<Policy>::parsing_system(Policy policy, grammar gram, size_t initial_stack_capacity, std::shared_ptr<logger> lgr)
         : lgr(lgr),
         _policy(std::move(policy)),
-        _gram(gram) {
+        _gram(gram),
+        _gramdat(&launder_grammar_data(_gram)) {
         _stack.reserve(initial_stack_capacity);
     }
 
@@ -211,6 +295,30 @@ namespace taul::internal {
         return _parse(start_rule);
     }
 
+    template<typename Policy>
+    inline typename parsing_system<Policy>::snapshot parsing_system<Policy>::take_snapshot() const {
+        return snapshot{
+            .stack = _stack,
+            .current_depth = _current_depth,
+        };
+    }
+
+    template<typename Policy>
+    inline void parsing_system<Policy>::restore_snapshot(const snapshot& x) {
+        _stack = x.stack; // <- copy assign, reusing _stack's memory
+        _current_depth = x.current_depth;
+    }
+
+    template<typename Policy>
+    inline bool parsing_system<Policy>::resume() {
+        return _resume();
+    }
+
+    template<typename Policy>
+    inline bool parsing_system<Policy>::suspended() const noexcept {
+        return _suspended;
+    }
+
     template<typename Policy>
     inline bool parsing_system<Policy>::check() {
         return _check();
@@ -228,7 +336,8 @@ namespace taul::internal {
     
     template<typename Policy>
     inline std::optional<size_t> parsing_system<Policy>::_lookup_in_pt(symbol_id nonterminal, symbol_id terminal) const {
-        const auto& pt = _policy.fetch_pt(_gram);
+        const auto& pt = _policy.fetch_pt(*_gramdat);
+        if (pt.predictor) return pt.predictor(nonterminal, terminal); // <- prefer direct-coded lookup, if any
         return pt.lookup(nonterminal, pt.grouper(terminal));
     }
     
@@ -271,27 +380,32 @@ namespace taul::internal {
     
     template<typename Policy>
     inline bool parsing_system<Policy>::_try_apply_terminal(const pt_terminal<symbol_type>& terminal, symbol_type input) {
-        const bool success = terminal.ids.contains(input.id);
-        if (success) {
-            if (!terminal.assertion) _output_terminal(input);
-        }
-        return success;
+        // outputting terminal is left to _match_terminal_with_eh, so as
+        // to have it occur after input is advanced
+        return terminal.ids.contains(input.id);
     }
     
     template<typename Policy>
     inline bool parsing_system<Policy>::_try_apply_nonterminal(const pt_nonterminal& nonterminal, symbol_type input) {
         const auto pt_index = _lookup_in_pt(nonterminal.id, input.id);
         if (pt_index) {
+            if (_policy.try_reuse_nonterminal(nonterminal.id, input)) return true;
+            if (_policy.try_defer_nonterminal(nonterminal.id, input)) return true;
             const auto& rule = _fetch_rule(pt_index.value());
-            _output_nonterminal_begin(nonterminal.id);
+            const bool transparent = _policy.fetch_ntia(*_gramdat).is_transparent(nonterminal.id);
+            // push terms prior to outputting the non-terminal's beginning, so the
+            // system is in a consistent state when output_nonterminal_begin is called
+            if (!transparent) _current_depth++;
             _push_terms(nonterminal, rule);
+            if (transparent) _debug_transparent_nonterminal();
+            else _output_nonterminal_begin(nonterminal.id);
         }
         return (bool)pt_index;
     }
 
     template<typename Policy>
     inline const pt_rule<typename parsing_system<Policy>::symbol_type>& parsing_system<Policy>::_fetch_rule(size_t pt_index) {
-        const auto& rules = _policy.fetch_pt(_gram).rules;
+        const auto& rules = _policy.fetch_pt(*_gramdat).rules;
         TAUL_ASSERT(pt_index < rules.size());
         return rules[pt_index];
     }
@@ -366,30 +480,32 @@ namespace taul::internal {
     
     template<typename Policy>
     inline void parsing_system<Policy>::_output_nonterminal_begin(symbol_id nonterminal) {
-        if (_policy.fetch_ntia(_gram).is_transparent(nonterminal)) {
-            _debug_transparent_nonterminal();
-            return;
-        }
+        // _current_depth is incremented by _try_apply_nonterminal
         _policy.output_nonterminal_begin(nonterminal);
-        _current_depth++;
     }
     
     template<typename Policy>
     inline void parsing_system<Policy>::_output_nonterminal_end() {
         TAUL_ASSERT(_current_depth > 0);
-        _policy.output_nonterminal_end();
         _current_depth--;
+        _policy.output_nonterminal_end();
     }
 
     template<typename Policy>
     inline void parsing_system<Policy>::_startup() {
         _output_startup();
-        if constexpr (Policy::uses_eh()) _policy.eh_startup();
+        if constexpr (Policy::uses_eh()) {
+            _policy.eh_startup();
+            _eh_started = true;
+        }
     }
     
     template<typename Policy>
     inline void parsing_system<Policy>::_shutdown() {
-        if constexpr (Policy::uses_eh()) _policy.eh_shutdown();
+        if constexpr (Policy::uses_eh()) {
+            _policy.eh_shutdown();
+            _eh_started = false;
+        }
         _output_shutdown();
     }
 
@@ -398,6 +514,10 @@ namespace taul::internal {
         auto input = _fetch_input_noadvance();
         auto result = _try_apply_terminal(terminal, input);
 
+        if (!result && !_policy.input_complete()) { // if failed, suspend until all input is available
+            _suspended = true;
+            return false;
+        }
         if (!result) { // if failed, try recovering, then try again
             _policy.output_terminal_error(terminal.ids, input); // report error
             if constexpr (Policy::uses_eh()) { // only attempt recovery if uses eh
@@ -411,7 +531,13 @@ namespace taul::internal {
         if (result) {
             // for terminals, for the error handler to work as expected, we want to
             // NOT advance the input state until AFTER we've finished everything above
-            if (!terminal.assertion) _fetch_input_advance();
+            
+            // the terminal is output after advancing, so the system is in a consistent
+            // state when output_terminal is called
+            if (!terminal.assertion) {
+                _fetch_input_advance();
+                _output_terminal(input);
+            }
         }
         else {
             _policy.eh_recovery_failed();
@@ -425,6 +551,10 @@ namespace taul::internal {
         auto input = _fetch_input_noadvance();
         auto result = _try_apply_nonterminal(nonterminal, input);
 
+        if (!result && !_policy.input_complete()) { // if failed, suspend until all input is available
+            _suspended = true;
+            return false;
+        }
         if (!result) { // if failed, try recovering, then try again
             _policy.output_nonterminal_error(nonterminal.id, input); // report error
             if constexpr (Policy::uses_eh()) { // only attempt recovery if uses eh
@@ -471,17 +601,59 @@ namespace taul::internal {
         return {};
     }
 
+    template<typename Policy>
+    inline bool parsing_system<Policy>::_must_suspend(const pt_term<symbol_type>& term) {
+        // only terminals and non-terminals query input
+        return
+            (term.is_terminal() || term.is_nonterminal()) &&
+            !_policy.input_ready();
+    }
+
     template<typename Policy>
     inline bool parsing_system<Policy>::_parse(rule_ref_type start_rule) {
         _setup(start_rule);
         _debug_parse_begin();
         _startup();
+        return _run();
+    }
+
+    template<typename Policy>
+    inline bool parsing_system<Policy>::_resume() {
+        // startup/shutdown pair up around a round of parsing, so only begin a new
+        // round if the last has ended (ie. resuming from a restored checkpoint),
+        // and not if it's still ongoing (ie. resuming after suspending)
+        if constexpr (Policy::uses_eh()) {
+            if (!_eh_started) {
+                _policy.eh_startup();
+                _eh_started = true;
+            }
+        }
+        return _run();
+    }
+
+    template<typename Policy>
+    inline bool parsing_system<Policy>::_run() {
+        _suspended = false;
         while (true) {
             _debug_parse_step();
-            const auto top = _consume_top();
-            if (!top) break; // exiting here means we're successful
-            _handle_nonterminal_ending(top.value().depth);
-            if (!_match_term(top.value().term)) {
+            if (!_policy.within_limits(_stack.size())) {
+                _shutdown();
+                return false; // aborted
+            }
+            if (_stack.empty()) break; // exiting here means we're successful
+            // handle ending prior to popping top, so the system is in a consistent
+            // state when output_nonterminal_end is called
+            _handle_nonterminal_ending(_stack.back().depth);
+            if (_must_suspend(_stack.back().term)) {
+                _suspended = true;
+                return false; // suspended, w/out shutdown
+            }
+            const auto top = _pop();
+            if (!_match_term(top.term)) {
+                if (_suspended) { // failed matches w/out side effects, so put top back
+                    _stack.push_back(top);
+                    return false; // suspended, w/out shutdown
+                }
                 _shutdown();
                 return false; // failure
             }
@@ -501,6 +673,7 @@ namespace taul::internal {
     inline void parsing_system<Policy>::_bind_check_for_nonterminal(const pt_nonterminal& nonterminal) {
         _check_is_for_terminal = false;
         _check_nonterminal_id = nonterminal.id;
+        _check_recovery_set = _policy.fetch_pt(*_gramdat).fetch_recovery_set(nonterminal.id);
     }
     
     template<typename Policy>
@@ -508,7 +681,15 @@ namespace taul::internal {
         return
             _check_is_for_terminal
             ? _check_terminal_ids.contains(_fetch_input_noadvance().id)
-            : _lookup_in_pt(_check_nonterminal_id, _fetch_input_noadvance().id).has_value();
+            : _check_nonterminal(_fetch_input_noadvance().id);
+    }
+
+    template<typename Policy>
+    inline bool parsing_system<Policy>::_check_nonterminal(symbol_id input) const {
+        return
+            _check_recovery_set
+            ? _check_recovery_set->contains(input)
+            : _lookup_in_pt(_check_nonterminal_id, input).has_value();
     }
 
     template<typename Policy>
@@ -0,0 +1,115 @@
+
+
+#pragma once
+
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../asserts.h"
+#include "../symbol_id.h"
+#include "../symbol_range.h"
+#include "../symbols.h"
+
+
+namespace taul::internal {
+
+
+    // recovery sets are precomputed bitsets over token IDs, used to give parser
+    // error recovery (ie. eh_check) a single bit test per token, rather than
+    // a parse table lookup (ie. grouper search + hash probe)
+
+    // bits cover LPR IDs [first_lpr_id, first_lpr_id + width), w/ width being
+    // picked such that every range endpoint below the last normal LPR ID lies
+    // within it, making membership uniform for IDs in [first_lpr_id + width,
+    // last normal LPR ID), w/ said membership being stored in _tail
+
+    // the last normal LPR ID, and failure/end IDs, are stored separately
+
+
+    class recovery_set final {
+    public:
+
+        inline recovery_set() = default;
+
+        // width is the number of LPR IDs covered by the bitset
+
+        // ranges are the (inclusive) symbol ID ranges in the set
+
+        // behaviour is undefined if width is not as described above
+
+        inline recovery_set(size_t width, std::span<const token_range> ranges);
+
+
+        // contains returns if x is in the set
+
+        inline bool contains(symbol_id x) const noexcept;
+
+
+        inline bool operator==(const recovery_set&) const noexcept = default;
+
+
+    private:
+
+        std::vector<std::uint64_t> _words;
+        size_t _width = 0;
+        bool _tail = false, _last = false, _failure = false, _end = false;
+    };
+
+
+    // recovery sets aren't built if their width would exceed this, w/ parser
+    // error recovery then falling back to parse table lookups
+
+    constexpr size_t max_recovery_set_width = 1 << 16;
+
+
+    // recovery_set_width returns the width for recovery sets over ranges
+
+    inline size_t recovery_set_width(std::span<const token_range> ranges) noexcept {
+        size_t result = 0;
+        constexpr symbol_id last = TAUL_LAST_NORMAL_ID(lpr);
+        for (const auto& r : ranges) {
+            for (symbol_id endpoint : { r.low, r.high }) {
+                if (endpoint < first_lpr_id || endpoint >= last) continue;
+                result = std::max(result, size_t(symbol_id_num(endpoint) - symbol_id_num(first_lpr_id)) + 1);
+            }
+        }
+        return result;
+    }
+
+
+    inline recovery_set::recovery_set(size_t width, std::span<const token_range> ranges)
+        : _words((width + 63) / 64, 0),
+        _width(width) {
+        const auto first = symbol_id_num(first_lpr_id);
+        const auto last = symbol_id_num(TAUL_LAST_NORMAL_ID(lpr));
+        const auto tail = first + symbol_id_num(_width); // representative of the tail
+        for (const auto& r : ranges) {
+            const auto low = symbol_id_num(r.low), high = symbol_id_num(r.high);
+            for (auto i = std::max(low, first); i <= high && i < tail; i++) {
+                const size_t index = size_t(i - first);
+                _words[index / 64] |= std::uint64_t(1) << (index % 64);
+            }
+            if (low <= tail && high >= tail && tail < last) _tail = true;
+            if (low <= last && high >= last) _last = true;
+            if (r.contains(failure_lpr_id)) _failure = true;
+            if (r.contains(end_lpr_id)) _end = true;
+        }
+    }
+
+    inline bool recovery_set::contains(symbol_id x) const noexcept {
+        const auto first = symbol_id_num(first_lpr_id);
+        const auto last = symbol_id_num(TAUL_LAST_NORMAL_ID(lpr));
+        const auto id = symbol_id_num(x);
+        if (id >= first && id - first < _width) {
+            const size_t index = size_t(id - first);
+            return (_words[index / 64] >> (index % 64)) & 1;
+        }
+        if (x == failure_lpr_id) return _failure;
+        if (x == end_lpr_id) return _end;
+        if (id == last) return _last;
+        return _tail && id >= first && id < last;
+    }
+}
@@ -2,6 +2,8 @@
 
 #include "rule_pt_translator.h"
 
+#include <thread>
+
 #include "../string_and_charset.h"
 
 
@@ -12,6 +14,42 @@ using namespace taul::string_literals;
 #define _DUMP_OUTPUT_LOG 0
 
 
+// the lexer/parser parse tables are independent of one another, and so are built
+// concurrently, except for small grammars, for which spawning a thread costs more
+// than it saves
+
+static constexpr size_t _concurrent_build_min_rules = 64;
+
+
+// parse tables are optimized prior to building, however if building the optimized
+// rules reports errors, the table is rebuilt from the unoptimized rules, so that
+// diagnostics are reported in terms of the rules as the spec defined them
+
+template<typename Symbol>
+static bool _built_without_errors(const taul::internal::parse_table<Symbol>& pt, const taul::internal::parse_table_build_details<Symbol>& ptbd) {
+    if (!ptbd.no_internal_errors() || !ptbd.collisions.empty()) return false;
+    // see loader's check_err_illegal_ambiguity_due_to_trivial_left_recursion
+    for (size_t i = 0; i < pt.rules.size(); i++) {
+        const auto& first_set_w = ptbd.first_sets_w[i];
+        if (first_set_w.empty() && !first_set_w.includes_epsilon()) return false;
+    }
+    return true;
+}
+
+template<typename Symbol>
+static void _optimize_and_build(taul::internal::parse_table<Symbol>& pt, taul::internal::parse_table_build_details<Symbol>& ptbd, taul::symbol_id first_helper_id) {
+    auto unoptimized = pt.rules;
+    pt.optimize(first_helper_id).build_mappings(ptbd);
+    if (_built_without_errors(pt, ptbd)) return;
+    // discard all state from the optimized build, so none of it (ie. collisions w/
+    // group IDs of the optimized grouper) leaks into the diagnostics reported
+    pt = taul::internal::parse_table<Symbol>{};
+    ptbd = taul::internal::parse_table_build_details<Symbol>{};
+    pt.rules = std::move(unoptimized);
+    pt.build_mappings(ptbd);
+}
+
+
 void taul::internal::rule_pt_translator::assert_in_composite_expr() const noexcept {
     TAUL_ASSERT(!composite_expr_stk.empty());
 }
@@ -356,8 +394,16 @@ void taul::internal::rule_pt_translator::on_shutdown() {
     // done_defining_main here, before anything else
     if (lexer_id_alloc.is_defining_main()) lexer_id_alloc.done_defining_main();
     if (parser_id_alloc.is_defining_main()) parser_id_alloc.done_defining_main();
-    lexer_pt.build_mappings(lexer_ptbd);
-    parser_pt.build_mappings(parser_ptbd);
+    const auto lexer_first_helper_id = lexer_id_alloc.output.first_helper_id;
+    const auto parser_first_helper_id = parser_id_alloc.output.first_helper_id;
+    if (std::min(lexer_pt.rules.size(), parser_pt.rules.size()) >= _concurrent_build_min_rules) {
+        std::jthread lexer_pt_builder([&] { _optimize_and_build(lexer_pt, lexer_ptbd, lexer_first_helper_id); }); // <- joins upon exiting scope
+        _optimize_and_build(parser_pt, parser_ptbd, parser_first_helper_id);
+    }
+    else {
+        _optimize_and_build(lexer_pt, lexer_ptbd, lexer_first_helper_id);
+        _optimize_and_build(parser_pt, parser_ptbd, parser_first_helper_id);
+    }
 #if _DUMP_LOG || _DUMP_OUTPUT_LOG
     TAUL_LOG(make_stderr_logger(), "(for LPRs)");
     TAUL_LOG(make_stderr_logger(), "{}", lexer_ptbd.fmt(lexer_pt.grouper));
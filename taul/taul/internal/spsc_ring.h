@@ -0,0 +1,179 @@
+
+
+#pragma once
+
+
+#include <atomic>
+#include <bit>
+#include <new>
+#include <vector>
+
+#include "../asserts.h"
+
+
+namespace taul::internal {
+
+
+    // spsc_ring is a bounded, lock-free, single-producer/single-consumer
+    // ring buffer, w/ one thread pushing values, and another popping them
+
+    // the producer *publishes* pushed values in batches, w/ pushed values
+    // not being visible to the consumer until published, so as to reduce
+    // cache line traffic between the two threads
+
+    // blocking is done via std::atomic wait/notify, rather than spinning
+
+    // capacity is rounded up to the next power of two
+
+
+    template<typename T>
+    class spsc_ring final {
+    public:
+
+        inline explicit spsc_ring(size_t capacity);
+
+
+        inline size_t capacity() const noexcept;
+
+
+        // these are to be used only by the producer
+
+        // try_push fails if the ring is full, w/ published values
+        // only becoming free once popped by the consumer
+
+        inline bool try_push(const T& x);
+
+        // publish makes pushed values visible to the consumer
+
+        inline void publish();
+
+        // wait_for_space blocks until the ring isn't full, publishing
+        // any pushed values prior to blocking
+
+        inline void wait_for_space();
+
+        // pending returns the number of pushed values yet to be published
+
+        inline size_t pending() const noexcept;
+
+
+        // these are to be used only by the consumer
+
+        // front returns a pointer to the next published value, or nullptr
+        // if there isn't one, w/ pop popping it
+
+        inline const T* front();
+        inline void pop();
+
+        // wait_for_data blocks until there's a published value to pop
+
+        inline void wait_for_data();
+
+
+        // clear discards all values
+
+        // behaviour is undefined if called while either thread is using the ring
+
+        inline void clear() noexcept;
+
+
+    private:
+
+        // producer/consumer state are placed on separate cache lines, so 
+        // the two threads don't contend over them (ie. false sharing)
+
+        static constexpr size_t _cache_line = 64;
+
+
+        std::vector<T> _slots;
+        size_t _mask;
+
+        alignas(_cache_line) std::atomic<size_t> _head = 0; // written by consumer
+        alignas(_cache_line) std::atomic<size_t> _tail = 0; // written by producer
+
+        alignas(_cache_line) size_t _producer_tail = 0; // includes unpublished values
+        size_t _producer_head_cache = 0; // last _head seen by producer
+
+        alignas(_cache_line) size_t _consumer_tail_cache = 0; // last _tail seen by consumer
+    };
+
+
+    template<typename T>
+    inline spsc_ring<T>::spsc_ring(size_t capacity)
+        : _slots(std::bit_ceil(capacity < 1 ? size_t(1) : capacity)),
+        _mask(_slots.size() - 1) {}
+
+    template<typename T>
+    inline size_t spsc_ring<T>::capacity() const noexcept {
+        return _slots.size();
+    }
+
+    template<typename T>
+    inline bool spsc_ring<T>::try_push(const T& x) {
+        if (_producer_tail - _producer_head_cache == capacity()) {
+            _producer_head_cache = _head.load(std::memory_order_acquire);
+            if (_producer_tail - _producer_head_cache == capacity()) return false;
+        }
+        _slots[_producer_tail & _mask] = x;
+        _producer_tail++;
+        return true;
+    }
+
+    template<typename T>
+    inline void spsc_ring<T>::publish() {
+        if (pending() == 0) return;
+        _tail.store(_producer_tail, std::memory_order_release);
+        _tail.notify_one();
+    }
+
+    template<typename T>
+    inline void spsc_ring<T>::wait_for_space() {
+        publish();
+        while (true) {
+            const size_t head = _head.load(std::memory_order_acquire);
+            _producer_head_cache = head;
+            if (_producer_tail - head < capacity()) break;
+            _head.wait(head, std::memory_order_acquire);
+        }
+    }
+
+    template<typename T>
+    inline size_t spsc_ring<T>::pending() const noexcept {
+        return _producer_tail - _tail.load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    inline const T* spsc_ring<T>::front() {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _consumer_tail_cache) {
+            _consumer_tail_cache = _tail.load(std::memory_order_acquire);
+            if (head == _consumer_tail_cache) return nullptr;
+        }
+        return &_slots[head & _mask];
+    }
+
+    template<typename T>
+    inline void spsc_ring<T>::pop() {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        TAUL_ASSERT(head != _consumer_tail_cache);
+        _head.store(head + 1, std::memory_order_release);
+        _head.notify_one();
+    }
+
+    template<typename T>
+    inline void spsc_ring<T>::wait_for_data() {
+        while (!front()) {
+            _tail.wait(_consumer_tail_cache, std::memory_order_acquire);
+        }
+    }
+
+    template<typename T>
+    inline void spsc_ring<T>::clear() noexcept {
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+        _producer_tail = 0;
+        _producer_head_cache = 0;
+        _consumer_tail_cache = 0;
+    }
+}
+
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <string_view>
+#include <span>
 #include <optional>
 #include "../../grammar.h"
 #include "../../export_fetcher.h"
@@ -7,8 +9,1792 @@
 namespace taul::fetchers {
     namespace details {
         struct taul_singleton_traits final {
-            static constexpr std::string_view get_serial_str() noexcept {
-                return "TAULAQAAAAAAAAAeAAAAAAAAACUAAAAAAAAACQAAAEVORF9PRl9LVwIIAAAAS1dfTEVYRVIACQAAAEtXX1BBUlNFUgAKAAAAS1dfU0VDVElPTgAHAAAAS1dfU0tJUAAKAAAAS1dfU1VQUE9SVAANAAAAS1dfUFJFQ0VERU5DRQAOAAAAS1dfUklHSFRfQVNTT0MABgAAAEtXX0VORAAGAAAAS1dfQU5ZAAgAAABLV19UT0tFTgAKAAAAS1dfRkFJTFVSRQAJAAAAT1BfUEVSSU9EAAgAAABPUF9DT0xPTgAMAAAAT1BfU0VNSUNPTE9OAAcAAABPUF9WQkFSAAsAAABPUF9RVUVTVElPTgALAAAAT1BfQVNURVJJU0sABwAAAE9QX1BMVVMADAAAAE9QX0FNUEVSU0FORAAIAAAAT1BfTUlOVVMACAAAAE9QX1RJTERFAAoAAABPUF9MX1JPVU5EAAoAAABPUF9SX1JPVU5EAAoAAABJREVOVElGSUVSAAYAAABTVFJJTkcABwAAAENIQVJTRVQACgAAAFdISVRFU1BBQ0UBBwAAAE5FV0xJTkUBBwAAAENPTU1FTlQBBAAAAFNwZWMABgAAAENsYXVzZQAMAAAATGV4ZXJTZWN0aW9uAA0AAABQYXJzZXJTZWN0aW9uAAQAAABSdWxlAA8AAABSdWxlX1F1YWxpZmllcnMACQAAAFJ1bGVfTmFtZQAJAAAAUnVsZV9BbHRzAAoAAABRdWFsaWZpZXJzAAkAAABRdWFsaWZpZXIADgAAAFF1YWxpZmllcl9Ta2lwABEAAABRdWFsaWZpZXJfU3VwcG9ydAAUAAAAUXVhbGlmaWVyX1ByZWNlZGVuY2UABAAAAEV4cHIADQAAAEV4cHJfTm9TdWZmaXgABAAAAEJhc2UABgAAAFN1ZmZpeAAHAAAAUHJpbWFyeQADAAAARW5kAAMAAABBbnkABQAAAFRva2VuAAcAAABGYWlsdXJlAAYAAABTdHJpbmcABwAAAENoYXJzZXQABAAAAE5hbWUACAAAAFNlcXVlbmNlAA0AAABTZXF1ZW5jZV9BbHRzAAkAAABMb29rQWhlYWQADAAAAExvb2tBaGVhZE5vdAADAAAATm90AA8AAABPcHRpb25hbF9TdWZmaXgAEQAAAEtsZWVuZVN0YXJfU3VmZml4ABEAAABLbGVlbmVQbHVzX1N1ZmZpeAAEAAAAQWx0cwALAAAAQWx0X0RpdmlkZXIAAwAAAEFsdAAKAAAAUmlnaHRBc3NvYwBMAAAAAAAAAAEAEQABAAAAAAAAAAEfABEA/////x8AEQABAAAAAAAAAAAAAAAALwAAAAEfABEAAQAAAAAAAAAAOgAAAEAAAAABHwARAAEAAAAAAAAAAFsAAABeAAAAAR8AEQABAAAAAAAAAABgAAAAYAAAAAEfABEAAQAAAAAAAAAAewAAAP//EAABAQARAAEAAAAAAAAAAAAAEQAAABEAAQIAEQAGAAAAAAAAAABsAAAAbAAAAAAAZQAAAGUAAAAAAHgAAAB4AAAAAABlAAAAZQAAAAAAcgAAAHIAAAAAAQEAEQAAAAAAAwARAAcAAAAAAAAAAHAAAABwAAAAAABhAAAAYQAAAAAAcgAAAHIAAAAAAHMAAABzAAAAAABlAAAAZQAAAAAAcgAAAHIAAAAAAQEAEQAAAAAABAARAAgAAAAAAAAAAHMAAABzAAAAAABlAAAAZQAAAAAAYwAAAGMAAAAAAHQAAAB0AAAAAABpAAAAaQAAAAAAbwAAAG8AAAAAAG4AAABuAAAAAAEBABEAAAAAAAUAEQAFAAAAAAAAAABzAAAAcwAAAAAAawAAAGsAAAAAAGkAAABpAAAAAABwAAAAcAAAAAABAQARAAAAAAAGABEACAAAAAAAAAAAcwAAAHMAAAAAAHUAAAB1AAAAAABwAAAAcAAAAAAAcAAAAHAAAAAAAG8AAABvAAAAAAByAAAAcgAAAAAAdAAAAHQAAAAAAQEAEQAAAAAABwARAAsAAAAAAAAAAHAAAABwAAAAAAByAAAAcgAAAAAAZQAAAGUAAAAAAGMAAABjAAAAAABlAAAAZQAAAAAAZAAAAGQAAAAAAGUAAABlAAAAAABuAAAAbgAAAAAAYwAAAGMAAAAAAGUAAABlAAAAAAEBABEAAAAAAAgAEQAMAAAAAAAAAAByAAAAcgAAAAAAaQAAAGkAAAAAAGcAAABnAAAAAABoAAAAaAAAAAAAdAAAAHQAAAAAAF8AAABfAAAAAABhAAAAYQAAAAAAcwAAAHMAAAAAAHMAAABzAAAAAABvAAAAbwAAAAAAYwAAAGMAAAAAAQEAEQAAAAAACQARAAQAAAAAAAAAAGUAAABlAAAAAABuAAAAbgAAAAAAZAAAAGQAAAAAAQEAEQAAAAAACgARAAQAAAAAAAAAAGEAAABhAAAAAABuAAAAbgAAAAAAeQAAAHkAAAAAAQEAEQAAAAAACwARAAYAAAAAAAAAAHQAAAB0AAAAAABvAAAAbwAAAAAAawAAAGsAAAAAAGUAAABlAAAAAABuAAAAbgAAAAABAQARAAAAAAAMABEACAAAAAAAAAAAZgAAAGYAAAAAAGEAAABhAAAAAABpAAAAaQAAAAAAbAAAAGwAAAAAAHUAAAB1AAAAAAByAAAAcgAAAAAAZQAAAGUAAAAAAQEAEQAAAAAADQARAAEAAAAAAAAAAC4AAAAuAAAAAA4AEQABAAAAAAAAAAA6AAAAOgAAAAAPABEAAQAAAAAAAAAAOwAAADsAAAAAEAARAAEAAAAAAAAAAHwAAAB8AAAAABEAEQABAAAAAAAAAAA/AAAAPwAAAAASABEAAQAAAAAAAAAAKgAAACoAAAAAEwARAAEAAAAAAAAAACsAAAArAAAAABQAEQABAAAAAAAAAAAmAAAAJgAAAAAVABEAAQAAAAAAAAAALQAAAC0AAAAAFgARAAEAAAAAAAAAAH4AAAB+AAAAABcAEQABAAAAAAAAAAAoAAAAKAAAAAAYABEAAQAAAAAAAAAAKQAAACkAAAAAGQARAAIAAAAAAAAAASAAEQD/////ASEAEQD/////IAARAAEAAAAAAAAAAEEAAABaAAAAACAAEQABAAAAAAAAAABfAAAAXwAAAAAgABEAAQAAAAAAAAAAYQAAAHoAAAAAIQARAAAAAAAAAAAAIQARAAIAAAAAAAAAASIAEQD/////ASEAEQD/////IgARAAEAAAAAAAAAADAAAAA5AAAAACIAEQABAAAAAAAAAABBAAAAWgAAAAAiABEAAQAAAAAAAAAAXwAAAF8AAAAAIgARAAEAAAAAAAAAAGEAAAB6AAAAABoAEQADAAAAAAAAAAAnAAAAJwAAAAABIwARAP////8BJgARAP////8jABEAAAAAAAAAAAAjABEAAgAAAAAAAAABJAARAP////8BIwARAP////8kABEAAgAAAAAAAAAAXAAAAFwAAAAAAAAAAAD//xAAACQAEQABAAAAAAAAAAElABEA/////yUAEQABAAAAAAAAAAAAAAAAJgAAAAAlABEAAQAAAAAAAAAAKAAAAFsAAAAAJQARAAEAAAAAAAAAAF0AAAD//xAAACYAEQAAAAAAAAAAACYAEQABAAAAAAAAAAAnAAAAJwAAAAAbABEAAwAAAAAAAAAAWwAAAFsAAAAAAScAEQD/////ASoAEQD/////JwARAAAAAAAAAAAAJwARAAIAAAAAAAAAASgAEQD/////AScAEQD/////KAARAAIAAAAAAAAAAFwAAABcAAAAAAAAAAAA//8QAAAoABEAAQAAAAAAAAABKQARAP////8pABEAAQAAAAAAAAAAAAAAAFsAAAAAKQARAAEAAAAAAAAAAF4AAAD//xAAACoAEQAAAAAAAAAAACoAEQABAAAAAAAAAABdAAAAXQAAAAAcABEAAQAAAAAAAAABKwARAP////8rABEAAgAAAAAAAAABLQARAP////8BLAARAP////8sABEAAAAAAAAAAAAsABEAAgAAAAAAAAABLQARAP////8BLAARAP////8tABEAAQAAAAAAAAABLgARAP////8uABEAAQAAAAAAAAAACQAAAAkAAAAALgARAAEAAAAAAAAAACAAAAAgAAAAAB0AEQABAAAAAAAAAAAKAAAACgAAAAAdABEAAgAAAAAAAAAADQAAAA0AAAAAAS8AEQD/////LwARAAAAAAAAAAAALwARAAEAAAAAAAAAAAoAAAAKAAAAAB4AEQACAAAAAAAAAAAjAAAAIwAAAAABMAARAP////8wABEAAAAAAAAAAAAwABEAAgAAAAAAAAABMQARAP////8BMAARAP////8xABEAAQAAAAAAAAAAAAAAAAkAAAAAMQARAAEAAAAAAAAAAAsAAAAMAAAAADEAEQABAAAAAAAAAAAOAAAA//8QAABCAAAAAAAAAAMAEgACAAAAAAAAAAEoABIA/////wACABIAAgASAAEoABIAAAAAAAAAAAAoABIAAgAAAAAAAAABBAASAAAAAAABKAASAP////8EABIAAQAAAAAAAAABBQASAAAAAAAEABIAAQAAAAAAAAABBgASAAAAAAAEABIAAQAAAAAAAAABBwASAAAAAAAFABIAAwAAAAAAAAAAAgARAAIAEQAAAAQAEQAEABEAAAAOABEADgARAAAGABIAAwAAAAAAAAAAAwARAAMAEQAAAAQAEQAEABEAAAAOABEADgARAAAHABIABQAAAAAAAAABCAASAAAAAAABCQASAAAAAAAADgARAA4AEQAAAQoAEgAAAAAAAA8AEQAPABEAAAgAEgABAAAAAAAAAAELABIAAAAAAAkAEgABAAAAAAAAAAAZABEAGQARAAAKABIAAQAAAAAAAAABJAASAAAAAAALABIAAQAAAAAAAAABKQASAP////8pABIAAAAAAAAAAAApABIAAgAAAAAAAAABDAASAAAAAAABKQASAP////8MABIAAQAAAAAAAAABDQASAAAAAAAMABIAAQAAAAAAAAABDgASAAAAAAAMABIAAQAAAAAAAAABDwASAAAAAAANABIAAQAAAAAAAAAABQARAAUAEQAADgASAAEAAAAAAAAAAAYAEQAGABEAAA8AEgABAAAAAAAAAAAHABEABwARAAAQABIAAgAAAAAAAAABEgASAAAAAAABKgASAP////8qABIAAAAAAAAAAAAqABIAAgAAAAAAAAABEwASAAAAAAABKgASAP////8RABIAAQAAAAAAAAABEgASAAAAAAASABIAAQAAAAAAAAABFAASAAAAAAASABIAAQAAAAAAAAABHAASAAAAAAASABIAAQAAAAAAAAABHgASAAAAAAASABIAAQAAAAAAAAABHwASAAAAAAASABIAAQAAAAAAAAABIAASAAAAAAATABIAAQAAAAAAAAABIQASAAAAAAATABIAAQAAAAAAAAABIgASAAAAAAATABIAAQAAAAAAAAABIwASAAAAAAAUABIAAQAAAAAAAAABFQASAAAAAAAUABIAAQAAAAAAAAABFgASAAAAAAAUABIAAQAAAAAAAAABFwASAAAAAAAUABIAAQAAAAAAAAABGAASAAAAAAAUABIAAQAAAAAAAAABGQASAAAAAAAUABIAAQAAAAAAAAABGgASAAAAAAAUABIAAQAAAAAAAAABGwASAAAAAAAVABIAAQAAAAAAAAAACQARAAkAEQAAFgASAAEAAAAAAAAAAAoAEQAKABEAABcAEgABAAAAAAAAAAALABEACwARAAAYABIAAQAAAAAAAAAADAARAAwAEQAAGQASAAEAAAAAAAAAABoAEQAaABEAABoAEgABAAAAAAAAAAAbABEAGwARAAAbABIAAQAAAAAAAAAAGQARABkAEQAAHAASAAMAAAAAAAAAABcAEQAXABEAAAEdABIAAAAAAAAYABEAGAARAAAdABIAAQAAAAAAAAABJAASAAAAAAAeABIAAgAAAAAAAAAAFAARABQAEQAAAREAEgAAAAAAHwASAAIAAAAAAAAAABUAEQAVABEAAAERABIAAAAAACAAEgACAAAAAAAAAAAWABEAFgARAAABEQASAAAAAAAhABIAAQAAAAAAAAAAEQARABEAEQAAIgASAAEAAAAAAAAAABIAEQASABEAACMAEgABAAAAAAAAAAATABEAEwARAAAkABIAAgAAAAAAAAABJgASAAAAAAABKwASAP////8rABIAAAAAAAAAAAArABIAAgAAAAAAAAABLAASAP////8BKwASAP////8sABIAAgAAAAAAAAABJQASAAAAAAABJgASAAAAAAAlABIAAQAAAAAAAAAAEAARABAAEQAAJgASAAEAAAAAAAAAAS0AEgD/////LQASAAAAAAAAAAAALQASAAIAAAAAAAAAAS4AEgD/////AS0AEgD/////LgASAAEAAAAAAAAAARAAEgAAAAAALgASAAEAAAAAAAAAAScAEgAAAAAAJwASAAEAAAAAAAAAAAgAEQAIABEAAA==";
+            static constexpr uint8_t image[] = {
+                0x54,0x41,0x55,0x4c,0x49,0x4d,0x47,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x09,0x00,0x00,0x00,0x45,0x4e,0x44,0x5f,0x4f,0x46,0x5f,0x4b,0x57,0x02,0x08,0x00,
+                0x00,0x00,0x4b,0x57,0x5f,0x4c,0x45,0x58,0x45,0x52,0x00,0x09,0x00,0x00,0x00,0x4b,
+                0x57,0x5f,0x50,0x41,0x52,0x53,0x45,0x52,0x00,0x0a,0x00,0x00,0x00,0x4b,0x57,0x5f,
+                0x53,0x45,0x43,0x54,0x49,0x4f,0x4e,0x00,0x07,0x00,0x00,0x00,0x4b,0x57,0x5f,0x53,
+                0x4b,0x49,0x50,0x00,0x0a,0x00,0x00,0x00,0x4b,0x57,0x5f,0x53,0x55,0x50,0x50,0x4f,
+                0x52,0x54,0x00,0x0d,0x00,0x00,0x00,0x4b,0x57,0x5f,0x50,0x52,0x45,0x43,0x45,0x44,
+                0x45,0x4e,0x43,0x45,0x00,0x0e,0x00,0x00,0x00,0x4b,0x57,0x5f,0x52,0x49,0x47,0x48,
+                0x54,0x5f,0x41,0x53,0x53,0x4f,0x43,0x00,0x06,0x00,0x00,0x00,0x4b,0x57,0x5f,0x45,
+                0x4e,0x44,0x00,0x06,0x00,0x00,0x00,0x4b,0x57,0x5f,0x41,0x4e,0x59,0x00,0x08,0x00,
+                0x00,0x00,0x4b,0x57,0x5f,0x54,0x4f,0x4b,0x45,0x4e,0x00,0x0a,0x00,0x00,0x00,0x4b,
+                0x57,0x5f,0x46,0x41,0x49,0x4c,0x55,0x52,0x45,0x00,0x09,0x00,0x00,0x00,0x4f,0x50,
+                0x5f,0x50,0x45,0x52,0x49,0x4f,0x44,0x00,0x08,0x00,0x00,0x00,0x4f,0x50,0x5f,0x43,
+                0x4f,0x4c,0x4f,0x4e,0x00,0x0c,0x00,0x00,0x00,0x4f,0x50,0x5f,0x53,0x45,0x4d,0x49,
+                0x43,0x4f,0x4c,0x4f,0x4e,0x00,0x07,0x00,0x00,0x00,0x4f,0x50,0x5f,0x56,0x42,0x41,
+                0x52,0x00,0x0b,0x00,0x00,0x00,0x4f,0x50,0x5f,0x51,0x55,0x45,0x53,0x54,0x49,0x4f,
+                0x4e,0x00,0x0b,0x00,0x00,0x00,0x4f,0x50,0x5f,0x41,0x53,0x54,0x45,0x52,0x49,0x53,
+                0x4b,0x00,0x07,0x00,0x00,0x00,0x4f,0x50,0x5f,0x50,0x4c,0x55,0x53,0x00,0x0c,0x00,
+                0x00,0x00,0x4f,0x50,0x5f,0x41,0x4d,0x50,0x45,0x52,0x53,0x41,0x4e,0x44,0x00,0x08,
+                0x00,0x00,0x00,0x4f,0x50,0x5f,0x4d,0x49,0x4e,0x55,0x53,0x00,0x08,0x00,0x00,0x00,
+                0x4f,0x50,0x5f,0x54,0x49,0x4c,0x44,0x45,0x00,0x0a,0x00,0x00,0x00,0x4f,0x50,0x5f,
+                0x4c,0x5f,0x52,0x4f,0x55,0x4e,0x44,0x00,0x0a,0x00,0x00,0x00,0x4f,0x50,0x5f,0x52,
+                0x5f,0x52,0x4f,0x55,0x4e,0x44,0x00,0x0a,0x00,0x00,0x00,0x49,0x44,0x45,0x4e,0x54,
+                0x49,0x46,0x49,0x45,0x52,0x00,0x06,0x00,0x00,0x00,0x53,0x54,0x52,0x49,0x4e,0x47,
+                0x00,0x07,0x00,0x00,0x00,0x43,0x48,0x41,0x52,0x53,0x45,0x54,0x00,0x0a,0x00,0x00,
+                0x00,0x57,0x48,0x49,0x54,0x45,0x53,0x50,0x41,0x43,0x45,0x01,0x07,0x00,0x00,0x00,
+                0x4e,0x45,0x57,0x4c,0x49,0x4e,0x45,0x01,0x07,0x00,0x00,0x00,0x43,0x4f,0x4d,0x4d,
+                0x45,0x4e,0x54,0x01,0x04,0x00,0x00,0x00,0x53,0x70,0x65,0x63,0x00,0x06,0x00,0x00,
+                0x00,0x43,0x6c,0x61,0x75,0x73,0x65,0x00,0x0c,0x00,0x00,0x00,0x4c,0x65,0x78,0x65,
+                0x72,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x00,0x0d,0x00,0x00,0x00,0x50,0x61,0x72,
+                0x73,0x65,0x72,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x00,0x04,0x00,0x00,0x00,0x52,
+                0x75,0x6c,0x65,0x00,0x0f,0x00,0x00,0x00,0x52,0x75,0x6c,0x65,0x5f,0x51,0x75,0x61,
+                0x6c,0x69,0x66,0x69,0x65,0x72,0x73,0x00,0x09,0x00,0x00,0x00,0x52,0x75,0x6c,0x65,
+                0x5f,0x4e,0x61,0x6d,0x65,0x00,0x09,0x00,0x00,0x00,0x52,0x75,0x6c,0x65,0x5f,0x41,
+                0x6c,0x74,0x73,0x00,0x0a,0x00,0x00,0x00,0x51,0x75,0x61,0x6c,0x69,0x66,0x69,0x65,
+                0x72,0x73,0x00,0x09,0x00,0x00,0x00,0x51,0x75,0x61,0x6c,0x69,0x66,0x69,0x65,0x72,
+                0x00,0x0e,0x00,0x00,0x00,0x51,0x75,0x61,0x6c,0x69,0x66,0x69,0x65,0x72,0x5f,0x53,
+                0x6b,0x69,0x70,0x00,0x11,0x00,0x00,0x00,0x51,0x75,0x61,0x6c,0x69,0x66,0x69,0x65,
+                0x72,0x5f,0x53,0x75,0x70,0x70,0x6f,0x72,0x74,0x00,0x14,0x00,0x00,0x00,0x51,0x75,
+                0x61,0x6c,0x69,0x66,0x69,0x65,0x72,0x5f,0x50,0x72,0x65,0x63,0x65,0x64,0x65,0x6e,
+                0x63,0x65,0x00,0x04,0x00,0x00,0x00,0x45,0x78,0x70,0x72,0x00,0x0d,0x00,0x00,0x00,
+                0x45,0x78,0x70,0x72,0x5f,0x4e,0x6f,0x53,0x75,0x66,0x66,0x69,0x78,0x00,0x04,0x00,
+                0x00,0x00,0x42,0x61,0x73,0x65,0x00,0x06,0x00,0x00,0x00,0x53,0x75,0x66,0x66,0x69,
+                0x78,0x00,0x07,0x00,0x00,0x00,0x50,0x72,0x69,0x6d,0x61,0x72,0x79,0x00,0x03,0x00,
+                0x00,0x00,0x45,0x6e,0x64,0x00,0x03,0x00,0x00,0x00,0x41,0x6e,0x79,0x00,0x05,0x00,
+                0x00,0x00,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x07,0x00,0x00,0x00,0x46,0x61,0x69,0x6c,
+                0x75,0x72,0x65,0x00,0x06,0x00,0x00,0x00,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x07,
+                0x00,0x00,0x00,0x43,0x68,0x61,0x72,0x73,0x65,0x74,0x00,0x04,0x00,0x00,0x00,0x4e,
+                0x61,0x6d,0x65,0x00,0x08,0x00,0x00,0x00,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,
+                0x00,0x0d,0x00,0x00,0x00,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x5f,0x41,0x6c,
+                0x74,0x73,0x00,0x09,0x00,0x00,0x00,0x4c,0x6f,0x6f,0x6b,0x41,0x68,0x65,0x61,0x64,
+                0x00,0x0c,0x00,0x00,0x00,0x4c,0x6f,0x6f,0x6b,0x41,0x68,0x65,0x61,0x64,0x4e,0x6f,
+                0x74,0x00,0x03,0x00,0x00,0x00,0x4e,0x6f,0x74,0x00,0x0f,0x00,0x00,0x00,0x4f,0x70,
+                0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x53,0x75,0x66,0x66,0x69,0x78,0x00,0x11,0x00,
+                0x00,0x00,0x4b,0x6c,0x65,0x65,0x6e,0x65,0x53,0x74,0x61,0x72,0x5f,0x53,0x75,0x66,
+                0x66,0x69,0x78,0x00,0x11,0x00,0x00,0x00,0x4b,0x6c,0x65,0x65,0x6e,0x65,0x50,0x6c,
+                0x75,0x73,0x5f,0x53,0x75,0x66,0x66,0x69,0x78,0x00,0x04,0x00,0x00,0x00,0x41,0x6c,
+                0x74,0x73,0x00,0x0b,0x00,0x00,0x00,0x41,0x6c,0x74,0x5f,0x44,0x69,0x76,0x69,0x64,
+                0x65,0x72,0x00,0x03,0x00,0x00,0x00,0x41,0x6c,0x74,0x00,0x0a,0x00,0x00,0x00,0x52,
+                0x69,0x67,0x68,0x74,0x41,0x73,0x73,0x6f,0x63,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1f,
+                0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x1f,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x01,0x1f,0x00,0x11,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x40,0x00,
+                0x00,0x00,0x01,0x1f,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x01,0x1f,0x00,0x11,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x1f,
+                0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,
+                0xff,0xff,0x10,0x00,0x01,0x01,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x01,0x02,0x00,0x11,0x00,0x06,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,
+                0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+                0x78,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,
+                0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x03,0x00,0x11,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+                0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,
+                0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,
+                0x00,0x73,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,
+                0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,
+                0x00,0x00,0x00,0x04,0x00,0x11,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,
+                0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x74,0x00,
+                0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x69,0x00,0x00,0x00,
+                0x00,0x00,0x6f,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,
+                0x6e,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+                0x11,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,
+                0x00,0x00,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x00,0x00,0x69,
+                0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
+                0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x11,0x00,0x08,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+                0x00,0x00,0x75,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+                0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,
+                0x6f,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,
+                0x00,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x01,0x01,0x00,
+                0x11,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x11,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,
+                0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,
+                0x00,0x63,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,
+                0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x65,
+                0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,0x6e,0x00,0x00,
+                0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,
+                0x00,0x65,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x08,
+                0x00,0x11,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
+                0x72,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x00,0x00,
+                0x67,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x68,0x00,
+                0x00,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x5f,0x00,
+                0x00,0x00,0x5f,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
+                0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+                0x73,0x00,0x00,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,
+                0x63,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x09,0x00,0x11,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,
+                0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,0x6e,0x00,0x00,
+                0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,
+                0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x11,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,
+                0x6e,0x00,0x00,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x00,0x01,
+                0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x06,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x6f,
+                0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x6b,0x00,0x00,
+                0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,
+                0x00,0x6e,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0c,
+                0x00,0x11,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+                0x66,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x00,0x00,
+                0x69,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6c,0x00,
+                0x00,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x72,0x00,
+                0x00,0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,
+                0x00,0x01,0x01,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x11,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x00,
+                0x0e,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x00,0x00,
+                0x00,0x3a,0x00,0x00,0x00,0x00,0x0f,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,0x10,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x7c,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+                0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x00,0x13,0x00,
+                0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x2b,
+                0x00,0x00,0x00,0x00,0x14,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x26,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x00,
+                0x16,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,
+                0x00,0x7e,0x00,0x00,0x00,0x00,0x17,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x18,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x29,0x00,0x00,
+                0x00,0x00,0x19,0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,
+                0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,0x21,0x00,0x11,0x00,0xff,0xff,0xff,0xff,
+                0x20,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,
+                0x00,0x5a,0x00,0x00,0x00,0x00,0x20,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x00,0x20,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,
+                0x00,0x00,0x21,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
+                0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0x00,0x11,0x00,0xff,
+                0xff,0xff,0xff,0x01,0x21,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x22,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x39,0x00,0x00,
+                0x00,0x00,0x22,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,
+                0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x00,0x22,0x00,0x11,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x00,0x22,0x00,
+                0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x11,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x01,0x23,0x00,0x11,0x00,0xff,
+                0xff,0xff,0xff,0x01,0x26,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x23,0x00,0x11,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x24,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,0x23,0x00,
+                0x11,0x00,0xff,0xff,0xff,0xff,0x24,0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0xff,0xff,0x10,0x00,0x00,0x24,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x25,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x25,0x00,0x11,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+                0x00,0x25,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,
+                0x00,0x00,0x5b,0x00,0x00,0x00,0x00,0x25,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x00,0x26,0x00,0x11,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x11,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x1b,
+                0x00,0x11,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
+                0x5b,0x00,0x00,0x00,0x00,0x01,0x27,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,0x2a,
+                0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x27,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x27,0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x28,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,0x27,0x00,0x11,0x00,0xff,0xff,0xff,
+                0xff,0x28,0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,
+                0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x10,0x00,
+                0x00,0x28,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x00,
+                0x11,0x00,0xff,0xff,0xff,0xff,0x29,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x00,0x29,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0xff,0xff,0x10,
+                0x00,0x00,0x2a,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0x00,
+                0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5d,
+                0x00,0x00,0x00,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x01,0x2e,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,0x2c,0x00,0x11,0x00,0xff,0xff,
+                0xff,0xff,0x2c,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,
+                0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2e,0x00,0x11,0x00,0xff,
+                0xff,0xff,0xff,0x01,0x2c,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x2e,0x00,0x11,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,
+                0x00,0x00,0x2e,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
+                0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x1d,0x00,0x11,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x1d,0x00,
+                0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,
+                0x00,0x00,0x00,0x00,0x01,0x2f,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x2f,0x00,0x11,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x1e,
+                0x00,0x11,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+                0x23,0x00,0x00,0x00,0x00,0x01,0x30,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x30,0x00,
+                0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x01,
+                0x30,0x00,0x11,0x00,0xff,0xff,0xff,0xff,0x31,0x00,0x11,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x31,0x00,
+                0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,
+                0x00,0x00,0x00,0x00,0x31,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x0e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,
+                0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1f,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x22,0x00,
+                0x00,0x00,0x23,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x25,0x00,
+                0x00,0x00,0x26,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,
+                0x00,0x00,0x28,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x29,0x00,
+                0x00,0x00,0x2a,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x2b,0x00,
+                0x00,0x00,0x2c,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2d,0x00,
+                0x00,0x00,0x2e,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x2f,0x00,
+                0x00,0x00,0x30,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x3a,0x00,
+                0x00,0x00,0x3b,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x3e,0x00,
+                0x00,0x00,0x3f,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x00,
+                0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5b,0x00,
+                0x00,0x00,0x5c,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5d,0x00,
+                0x00,0x00,0x5e,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,
+                0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,
+                0x00,0x00,0x62,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,
+                0x00,0x00,0x66,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0x6b,0x00,
+                0x00,0x00,0x6c,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x6f,0x00,
+                0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x71,0x00,
+                0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,
+                0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x7a,0x00,
+                0x00,0x00,0x7b,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x7c,0x00,
+                0x00,0x00,0x7d,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x7e,0x00,
+                0x00,0x00,0x7f,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+                0x11,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x15,0x00,
+                0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x1b,0x00,
+                0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x20,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x2e,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x33,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x26,0x00,
+                0x00,0x00,0x26,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x11,0x00,0x28,0x00,
+                0x00,0x00,0x28,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x00,0x11,0x00,0x2b,0x00,
+                0x00,0x00,0x2b,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x2b,0x00,
+                0x00,0x00,0x2b,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x11,0x00,0x2b,0x00,
+                0x00,0x00,0x2b,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x07,0x00,0x11,0x00,0x28,0x00,
+                0x00,0x00,0x28,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x2a,0x00,
+                0x00,0x00,0x2a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x23,0x00,
+                0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x0a,0x00,0x11,0x00,0x21,0x00,
+                0x00,0x00,0x21,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x2c,0x00,
+                0x00,0x00,0x2c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0c,0x00,0x11,0x00,0x24,0x00,
+                0x00,0x00,0x24,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x11,0x00,0x12,0x00,
+                0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,0x00,0x11,0x00,0x15,0x00,
+                0x00,0x00,0x15,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0f,0x00,0x11,0x00,0x16,0x00,
+                0x00,0x00,0x16,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x2f,0x00,
+                0x00,0x00,0x2f,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x18,0x00,
+                0x00,0x00,0x18,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x0e,0x00,
+                0x00,0x00,0x0e,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x13,0x00,0x11,0x00,0x0f,0x00,
+                0x00,0x00,0x0f,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x14,0x00,0x11,0x00,0x0a,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x11,0x00,
+                0x00,0x00,0x11,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x16,0x00,0x11,0x00,0x31,0x00,
+                0x00,0x00,0x31,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x17,0x00,0x11,0x00,0x0c,0x00,
+                0x00,0x00,0x0c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x18,0x00,0x11,0x00,0x0d,0x00,
+                0x00,0x00,0x0d,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x1a,0x00,
+                0x00,0x00,0x1a,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x1f,0x00,
+                0x00,0x00,0x1f,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x21,0x00,
+                0x00,0x00,0x2d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x1a,0x00,0x11,0x00,0x0b,0x00,
+                0x00,0x00,0x0b,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x1b,0x00,0x11,0x00,0x1b,0x00,
+                0x00,0x00,0x1b,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x1c,0x00,0x11,0x00,0x01,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x1c,0x00,0x11,0x00,0x06,0x00,
+                0x00,0x00,0x06,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x1d,0x00,0x11,0x00,0x02,0x00,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x1d,0x00,0x11,0x00,0x04,0x00,
+                0x00,0x00,0x04,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x1e,0x00,0x11,0x00,0x08,0x00,
+                0x00,0x00,0x08,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x13,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x15,0x00,
+                0x00,0x00,0x19,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x1b,0x00,
+                0x00,0x00,0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x20,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x2e,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x00,0x11,0x00,0x1a,0x00,
+                0x00,0x00,0x1a,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x20,0x00,0x11,0x00,0x1f,0x00,
+                0x00,0x00,0x1f,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x11,0x00,0x21,0x00,
+                0x00,0x00,0x2d,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x13,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x14,0x00,
+                0x00,0x00,0x14,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x15,0x00,
+                0x00,0x00,0x19,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x1a,0x00,
+                0x00,0x00,0x1a,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x1b,0x00,
+                0x00,0x00,0x1e,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x1f,0x00,
+                0x00,0x00,0x1f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x20,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x21,0x00,
+                0x00,0x00,0x2d,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x2e,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x22,0x00,0x11,0x00,0x14,0x00,
+                0x00,0x00,0x14,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x22,0x00,0x11,0x00,0x1a,0x00,
+                0x00,0x00,0x1a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x22,0x00,0x11,0x00,0x1f,0x00,
+                0x00,0x00,0x1f,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x22,0x00,0x11,0x00,0x21,0x00,
+                0x00,0x00,0x2d,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x0b,0x00,
+                0x00,0x00,0x0b,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x0c,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x33,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x24,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x24,0x00,0x11,0x00,0x0c,0x00,
+                0x00,0x00,0x1b,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x24,0x00,0x11,0x00,0x1c,0x00,
+                0x00,0x00,0x1c,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x24,0x00,0x11,0x00,0x1d,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x25,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x25,0x00,0x11,0x00,0x0c,0x00,
+                0x00,0x00,0x1b,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x11,0x00,0x1d,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x26,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x0a,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x26,0x00,0x11,0x00,0x0b,0x00,
+                0x00,0x00,0x0b,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x26,0x00,0x11,0x00,0x0c,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x27,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x1c,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x27,0x00,0x11,0x00,0x1d,0x00,
+                0x00,0x00,0x1d,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x27,0x00,0x11,0x00,0x1e,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x27,0x00,0x11,0x00,0x33,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x28,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x1b,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,0x11,0x00,0x1c,0x00,
+                0x00,0x00,0x1c,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x28,0x00,0x11,0x00,0x1e,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x29,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x1b,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x29,0x00,0x11,0x00,0x1e,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x2a,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x1c,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x2a,0x00,0x11,0x00,0x1d,0x00,
+                0x00,0x00,0x1d,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x2a,0x00,0x11,0x00,0x1e,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,0x01,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,0x02,0x00,
+                0x00,0x00,0x05,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,0x06,0x00,
+                0x00,0x00,0x06,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,0x07,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x2e,0x00,0x11,0x00,0x01,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x2e,0x00,0x11,0x00,0x06,0x00,
+                0x00,0x00,0x06,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,0x02,0x00,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,0x03,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x02,0x00,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x03,0x00,
+                0x00,0x00,0x03,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x04,0x00,
+                0x00,0x00,0x04,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x05,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x33,0x00,
+                0x00,0x00,0x33,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x31,0x00,0x11,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x31,0x00,0x11,0x00,0x03,0x00,
+                0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x31,0x00,0x11,0x00,0x05,0x00,
+                0x00,0x00,0x32,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x5b,
+                0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x7b,
+                0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x03,0x00,0x11,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
+                0x00,0x04,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,
+                0x00,0x00,0x73,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x06,0x00,0x11,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+                0x07,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,
+                0x00,0x70,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x0a,
+                0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
+                0x61,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,0x00,0x11,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x0d,0x00,
+                0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x2e,
+                0x00,0x00,0x00,0x0e,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x3a,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x0f,0x00,0x11,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x10,0x00,0x11,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x7c,0x00,
+                0x00,0x00,0x11,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+                0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x13,0x00,0x11,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x2b,0x00,0x00,
+                0x00,0x14,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,
+                0x00,0x00,0x26,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x16,0x00,0x11,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,
+                0x17,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,
+                0x00,0x28,0x00,0x00,0x00,0x18,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x29,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x00,0x03,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,
+                0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x1a,
+                0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+                0x27,0x00,0x00,0x00,0x1b,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x5b,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x1c,0x00,0x11,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x20,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x1d,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,
+                0x00,0x00,0x00,0x1e,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x23,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1f,0x00,0x11,0x00,0x00,0x05,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3a,0x00,0x00,
+                0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x60,0x00,0x00,
+                0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x20,0x00,0x11,
+                0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,
+                0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,
+                0x00,0x00,0x21,0x00,0x11,0x00,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+                0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,
+                0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x22,
+                0x00,0x11,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+                0x39,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+                0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x23,0x00,0x11,0x00,
+                0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,
+                0x00,0x28,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x24,0x00,0x11,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x28,0x00,
+                0x00,0x00,0xff,0xff,0x10,0x00,0x25,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x5b,
+                0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x26,0x00,0x11,0x00,0x01,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+                0x27,0x00,0x11,0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x5c,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x28,0x00,0x11,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,
+                0x00,0x00,0x5e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x29,0x00,0x11,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,
+                0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x2a,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x2c,0x00,0x11,0x00,
+                0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,
+                0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x2e,0x00,0x11,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x20,0x00,
+                0x00,0x00,0x20,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x30,0x00,0x11,0x00,0x01,
+                0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+                0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,
+                0x31,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x09,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0e,0x00,0x00,
+                0x00,0xff,0xff,0x10,0x00,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,
+                0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x39,0x00,
+                0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,
+                0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x6d,
+                0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x03,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x71,0x00,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x05,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x72,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x06,0x00,
+                0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,
+                0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,
+                0x71,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x73,0x00,0x00,
+                0x00,0x00,0x00,0x11,0x00,0x09,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x00,0x00,
+                0x11,0x00,0x0a,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x0b,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x73,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,
+                0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,
+                0x00,0x67,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2f,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x0e,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,
+                0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+                0x10,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x7b,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x11,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,
+                0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x2b,
+                0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x15,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x2c,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x16,0x00,
+                0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,
+                0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+                0x29,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x2a,0x00,0x00,
+                0x00,0x00,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,
+                0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x00,0x00,
+                0x11,0x00,0x1a,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x1b,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x5a,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,
+                0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
+                0x00,0x0a,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x1d,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x09,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0e,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x1e,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,
+                0x00,0x11,0x00,0x1f,0x00,0x11,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x30,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+                0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x20,0x00,0x11,0x00,0x00,0x04,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,
+                0x00,0x5e,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,
+                0x00,0x00,0x00,0x11,0x00,0x21,0x00,0x11,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x40,0x00,
+                0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,
+                0x00,0x00,0x7b,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x22,0x00,0x11,0x00,0x00,0x05,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3a,
+                0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x60,
+                0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x23,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+                0x27,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x24,0x00,0x11,0x00,
+                0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,
+                0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x25,0x00,0x11,0x00,0x00,0x03,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x5c,0x00,
+                0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x26,0x00,
+                0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,
+                0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x27,0x00,0x11,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x28,0x00,0x11,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x00,0x00,0x11,0x00,0x29,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x5c,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+                0x11,0x00,0x2a,0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x2c,
+                0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x08,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+                0x00,0x00,0x11,0x00,0x2e,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x1f,0x00,0x00,
+                0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x2f,0x00,0x11,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x0b,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x30,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,
+                0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x31,0x00,0x11,0x00,0x00,
+                0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+                0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,
+                0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x00,0x05,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3a,0x00,0x00,
+                0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x60,0x00,0x00,
+                0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x11,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6c,0x00,
+                0x00,0x00,0x03,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+                0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x05,0x00,0x11,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x73,0x00,0x00,
+                0x00,0x06,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,
+                0x00,0x00,0x73,0x00,0x00,0x00,0x07,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
+                0x09,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,
+                0x00,0x65,0x00,0x00,0x00,0x0a,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,
+                0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+                0x66,0x00,0x00,0x00,0x0d,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x2e,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x0e,0x00,0x11,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x0f,0x00,
+                0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3b,
+                0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x7c,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x12,0x00,0x11,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2a,0x00,
+                0x00,0x00,0x13,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,
+                0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x14,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x15,0x00,0x11,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2d,0x00,0x00,
+                0x00,0x16,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,
+                0x00,0x00,0x7e,0x00,0x00,0x00,0x17,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x18,0x00,0x11,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+                0x19,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,
+                0x00,0x5a,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,
+                0x00,0x7a,0x00,0x00,0x00,0x1a,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x1b,0x00,0x11,0x00,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x1c,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+                0x09,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x1d,0x00,0x11,0x00,
+                0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,
+                0x00,0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x1e,0x00,0x11,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1f,0x00,
+                0x11,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,
+                0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,
+                0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0xff,
+                0xff,0x10,0x00,0x20,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+                0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x21,0x00,0x11,0x00,0x01,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x22,0x00,0x11,
+                0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x39,0x00,
+                0x00,0x00,0x41,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5f,0x00,
+                0x00,0x00,0x61,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x23,0x00,0x11,0x00,0x01,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x24,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x26,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x25,0x00,0x11,0x00,
+                0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,
+                0x00,0x28,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0xff,0xff,0x10,
+                0x00,0x26,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x27,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x28,0x00,0x11,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,
+                0x5e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x29,0x00,0x11,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,
+                0x00,0xff,0xff,0x10,0x00,0x2a,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x2c,0x00,0x11,0x00,0x01,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x2e,
+                0x00,0x11,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+                0x09,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x2f,0x00,0x11,0x00,
+                0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x30,0x00,0x11,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x31,0x00,0x11,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,
+                0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0xff,0xff,0x10,0x00,0x42,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x03,0x00,0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x28,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x00,0x02,0x00,0x12,0x00,0x02,0x00,0x12,
+                0x00,0x01,0x28,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,
+                0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x12,0x00,0x00,
+                0x00,0x00,0x00,0x01,0x28,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x04,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x05,0x00,0x12,0x00,0x00,0x00,0x00,
+                0x00,0x04,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x00,
+                0x12,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x07,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x12,0x00,0x03,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x02,0x00,0x11,0x00,
+                0x00,0x00,0x04,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x11,0x00,
+                0x0e,0x00,0x11,0x00,0x00,0x06,0x00,0x12,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x03,0x00,0x11,0x00,0x03,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x11,0x00,
+                0x04,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x11,0x00,0x0e,0x00,0x11,0x00,0x00,0x07,
+                0x00,0x12,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x09,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+                0x11,0x00,0x0e,0x00,0x11,0x00,0x00,0x01,0x0a,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x0f,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x00,0x08,0x00,0x12,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0b,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x09,
+                0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x11,0x00,
+                0x19,0x00,0x11,0x00,0x00,0x0a,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x24,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x12,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x29,
+                0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x12,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0c,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+                0x01,0x29,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x0c,0x00,0x12,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x0d,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,
+                0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0e,0x00,0x12,0x00,0x00,
+                0x00,0x00,0x00,0x0c,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x0f,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x12,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x00,0x0e,0x00,
+                0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x11,0x00,0x06,
+                0x00,0x11,0x00,0x00,0x0f,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x07,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x00,0x10,0x00,0x12,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x2a,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x2a,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x2a,0x00,0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x01,0x13,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x01,0x2a,0x00,0x12,0x00,0xff,0xff,
+                0xff,0xff,0x11,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,
+                0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x01,0x14,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1c,0x00,0x12,0x00,0x00,0x00,0x00,
+                0x00,0x12,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1e,0x00,
+                0x12,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x1f,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x12,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+                0x13,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x00,0x12,
+                0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x22,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x12,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x23,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x14,
+                0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x15,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x14,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x01,0x16,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x12,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x17,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x14,0x00,
+                0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x18,0x00,0x12,0x00,0x00,
+                0x00,0x00,0x00,0x14,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x19,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x12,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x1a,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x12,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1b,0x00,0x12,0x00,0x00,0x00,
+                0x00,0x00,0x15,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+                0x00,0x11,0x00,0x09,0x00,0x11,0x00,0x00,0x16,0x00,0x12,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,0x00,0x17,0x00,
+                0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x0b,
+                0x00,0x11,0x00,0x00,0x18,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x0c,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x00,0x19,0x00,0x12,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x00,
+                0x1a,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x11,
+                0x00,0x1b,0x00,0x11,0x00,0x00,0x1b,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x00,0x1c,0x00,0x12,0x00,
+                0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x11,0x00,0x17,0x00,0x11,
+                0x00,0x00,0x01,0x1d,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x11,0x00,
+                0x18,0x00,0x11,0x00,0x00,0x1d,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x24,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x12,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x00,
+                0x01,0x11,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x12,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x15,0x00,0x11,0x00,0x00,0x01,
+                0x11,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x12,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x16,0x00,0x11,0x00,0x16,0x00,0x11,0x00,0x00,0x01,0x11,
+                0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x00,0x22,0x00,0x12,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x23,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x13,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x00,0x24,0x00,0x12,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x26,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x01,0x2b,
+                0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x2b,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x2b,0x00,0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x2c,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x01,0x2b,0x00,0x12,0x00,0xff,0xff,0xff,
+                0xff,0x2c,0x00,0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x25,0x00,
+                0x12,0x00,0x00,0x00,0x00,0x00,0x01,0x26,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x25,
+                0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x11,0x00,
+                0x10,0x00,0x11,0x00,0x00,0x26,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x2d,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x2d,0x00,0x12,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x2e,0x00,0x12,0x00,0xff,0xff,0xff,0xff,0x01,0x2d,0x00,0x12,0x00,
+                0xff,0xff,0xff,0xff,0x2e,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x01,0x10,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x12,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x27,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x27,0x00,
+                0x12,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x08,
+                0x00,0x11,0x00,0x00,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,
+                0x01,0x00,0x11,0x00,0x02,0x00,0x11,0x00,0x02,0x00,0x11,0x00,0x03,0x00,0x11,0x00,
+                0x03,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x05,0x00,0x11,0x00,
+                0x05,0x00,0x11,0x00,0x06,0x00,0x11,0x00,0x06,0x00,0x11,0x00,0x07,0x00,0x11,0x00,
+                0x07,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x09,0x00,0x11,0x00,
+                0x09,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,0x0b,0x00,0x11,0x00,
+                0x0b,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,
+                0x0f,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+                0x11,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x13,0x00,0x11,0x00,
+                0x13,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x15,0x00,0x11,0x00,
+                0x15,0x00,0x11,0x00,0x16,0x00,0x11,0x00,0x16,0x00,0x11,0x00,0x17,0x00,0x11,0x00,
+                0x17,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x19,0x00,0x11,0x00,
+                0x19,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,
+                0x1b,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x01,0x00,0x12,0x00,0x02,0x00,0x12,0x00,
+                0x02,0x00,0x12,0x00,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,
+                0x1a,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x12,0x00,
+                0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x12,0x00,
+                0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x07,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0b,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0c,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0c,0x00,0x12,0x00,
+                0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0c,0x00,0x12,0x00,
+                0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,0x00,0x12,0x00,
+                0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0f,0x00,0x12,0x00,
+                0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x10,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x10,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x10,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x11,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x11,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x11,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x13,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x13,0x00,0x12,0x00,
+                0x0e,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x13,0x00,0x12,0x00,
+                0x0f,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x13,0x00,0x12,0x00,
+                0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x0b,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x17,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x00,0x12,0x00,
+                0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x15,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x16,0x00,0x12,0x00,
+                0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x17,0x00,0x12,0x00,
+                0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x18,0x00,0x12,0x00,
+                0x0b,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x19,0x00,0x12,0x00,
+                0x17,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x1a,0x00,0x12,0x00,
+                0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x1b,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x1c,0x00,0x12,0x00,
+                0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x1d,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x1e,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x1f,0x00,0x12,0x00,
+                0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x20,0x00,0x12,0x00,
+                0x13,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x21,0x00,0x12,0x00,
+                0x0e,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x22,0x00,0x12,0x00,
+                0x0f,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x23,0x00,0x12,0x00,
+                0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x24,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x25,0x00,0x12,0x00,
+                0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x26,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x27,0x00,0x12,0x00,
+                0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x07,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x28,0x00,0x12,0x00,
+                0x17,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x29,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x12,0x00,
+                0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x29,0x00,0x12,0x00,
+                0x07,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x2a,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x2a,0x00,0x12,0x00,
+                0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x2a,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x2b,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x2b,0x00,0x12,0x00,
+                0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x2b,0x00,0x12,0x00,
+                0x0e,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x2c,0x00,0x12,0x00,
+                0x0d,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x07,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x15,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x2d,0x00,0x12,0x00,
+                0x19,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x2e,0x00,0x12,0x00,
+                0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x2e,0x00,0x12,0x00,
+                0x08,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2e,0x00,0x12,0x00,
+                0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2e,0x00,0x12,0x00,
+                0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x02,0x00,0x11,0x00,0x03,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,
+                0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x02,0x00,0x12,
+                0x00,0x04,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+                0x11,0x00,0x03,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x19,0x00,
+                0x11,0x00,0x19,0x00,0x11,0x00,0x05,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x02,0x00,0x11,0x00,0x06,0x00,0x12,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x11,0x00,0x03,0x00,0x11,0x00,
+                0x07,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,
+                0x00,0x07,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x08,0x00,0x12,
+                0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x07,0x00,
+                0x11,0x00,0x09,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+                0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x0a,0x00,0x12,0x00,0x01,0x04,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x10,0x00,0x11,0x00,
+                0x10,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,
+                0x1b,0x00,0x11,0x00,0x0b,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0c,0x00,0x12,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,
+                0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x05,
+                0x00,0x11,0x00,0x0e,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x06,0x00,0x11,0x00,0x06,0x00,0x11,0x00,0x0f,0x00,0x12,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x10,0x00,0x12,
+                0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x0c,0x00,
+                0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,
+                0x11,0x00,0x11,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+                0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,
+                0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x12,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,
+                0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x13,0x00,0x12,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x11,
+                0x00,0x14,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+                0x11,0x00,0x0c,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x15,0x00,
+                0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x09,
+                0x00,0x11,0x00,0x16,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x0a,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,0x17,0x00,0x12,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x11,0x00,0x0b,0x00,0x11,0x00,0x18,0x00,0x12,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x11,0x00,0x0c,0x00,
+                0x11,0x00,0x19,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,
+                0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x1a,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x1b,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x1b,0x00,0x12,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,
+                0x00,0x1c,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,
+                0x11,0x00,0x17,0x00,0x11,0x00,0x1d,0x00,0x12,0x00,0x01,0x04,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x10,
+                0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,
+                0x00,0x11,0x00,0x1e,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x14,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x1f,0x00,0x12,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x15,0x00,0x11,0x00,0x20,0x00,0x12,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00,0x11,0x00,0x16,0x00,
+                0x11,0x00,0x21,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x22,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x23,0x00,0x12,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x11,0x00,0x13,0x00,0x11,
+                0x00,0x24,0x00,0x12,0x00,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,
+                0x11,0x00,0x0c,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x14,0x00,
+                0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x25,0x00,
+                0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x10,
+                0x00,0x11,0x00,0x26,0x00,0x12,0x00,0x01,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,
+                0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x27,0x00,0x12,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x28,0x00,0x12,
+                0x00,0x01,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x03,0x00,
+                0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x19,0x00,
+                0x11,0x00,0x29,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+                0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x2a,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x2b,0x00,0x12,0x00,
+                0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x10,0x00,0x11,
+                0x00,0x2c,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,
+                0x11,0x00,0x10,0x00,0x11,0x00,0x2d,0x00,0x12,0x00,0x01,0x03,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,
+                0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x2e,0x00,0x12,0x00,0x00,
+                0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,
+                0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,
+                0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,0x00,0x04,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x01,0x00,0x11,0x00,0x04,0x00,0x11,
+                0x00,0x04,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1a,0x00,0x11,
+                0x00,0x01,0x00,0x12,0x00,0x04,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x01,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x04,0x00,
+                0x11,0x00,0x08,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x02,0x00,
+                0x12,0x00,0x05,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x00,0x11,0x00,0x01,0x00,0x11,0x00,0x03,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x06,
+                0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,
+                0x02,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x07,0x00,0x12,0x00,
+                0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x04,0x00,0x11,
+                0x00,0x08,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x08,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x04,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x09,0x00,
+                0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x18,
+                0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x0a,0x00,0x12,0x00,0x00,
+                0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x07,0x00,0x11,0x00,
+                0x0d,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x11,0x00,
+                0x18,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,
+                0x0b,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,
+                0x00,0x04,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x0c,0x00,0x12,
+                0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x04,0x00,
+                0x11,0x00,0x08,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x0d,0x00,0x12,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x06,
+                0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x0e,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,
+                0x02,0x00,0x12,0x00,0x0f,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x00,0x11,0x00,0x06,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x10,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x08,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,
+                0x11,0x00,0x18,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x11,0x00,
+                0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x08,
+                0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,
+                0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x00,
+                0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x08,0x00,0x11,0x00,
+                0x0d,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,0x00,0x11,0x00,
+                0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x13,0x00,0x12,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x14,0x00,0x11,
+                0x00,0x02,0x00,0x12,0x00,0x14,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x18,0x00,
+                0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x15,0x00,0x12,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x0a,
+                0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x16,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x09,0x00,0x11,0x00,0x0b,0x00,0x11,0x00,
+                0x02,0x00,0x12,0x00,0x17,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x18,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x0b,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x19,0x00,
+                0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x19,
+                0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x1a,0x00,0x12,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,
+                0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x1b,0x00,0x12,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1a,0x00,0x11,
+                0x00,0x02,0x00,0x12,0x00,0x1c,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x16,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x02,0x00,
+                0x12,0x00,0x1d,0x00,0x12,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x11,
+                0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1c,
+                0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x1e,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x15,0x00,0x11,0x00,
+                0x02,0x00,0x12,0x00,0x1f,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x16,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x20,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x15,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x21,0x00,
+                0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x10,
+                0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x22,0x00,0x12,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+                0x13,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x23,0x00,0x12,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x14,0x00,0x11,
+                0x00,0x02,0x00,0x12,0x00,0x24,0x00,0x12,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x0f,0x00,
+                0x11,0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,0x00,
+                0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x25,0x00,0x12,0x00,0x00,0x02,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x11,
+                0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x26,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,
+                0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,
+                0x02,0x00,0x12,0x00,0x27,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x09,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x28,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x01,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x04,0x00,0x11,0x00,0x08,0x00,
+                0x11,0x00,0x18,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x29,0x00,
+                0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x04,
+                0x00,0x11,0x00,0x08,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2a,0x00,0x12,0x00,0x00,
+                0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x10,0x00,0x11,0x00,
+                0x14,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2b,0x00,0x12,0x00,0x00,0x02,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x11,0x00,0x11,
+                0x00,0x02,0x00,0x12,0x00,0x2c,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x0f,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x02,0x00,
+                0x12,0x00,0x2d,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,
+                0x00,0x11,0x00,0x18,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2e,
+                0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,
+                0x07,0x00,0x11,0x00,0x0d,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x18,0x00,0x11,0x00,
+                0x18,0x00,0x11,0x00,0x1c,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2c,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x03,0x00,0x12,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x02,0x00,0x11,0x00,0x03,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,
+                0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x02,0x00,0x12,
+                0x00,0x04,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+                0x11,0x00,0x03,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x07,0x00,0x11,0x00,0x19,0x00,
+                0x11,0x00,0x19,0x00,0x11,0x00,0x05,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x02,0x00,0x11,0x00,0x06,0x00,0x12,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x11,0x00,0x03,0x00,0x11,0x00,
+                0x07,0x00,0x12,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,
+                0x00,0x07,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x08,0x00,0x12,
+                0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,
+                0x12,0x00,0x09,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+                0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x0a,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x0b,0x00,0x12,0x00,
+                0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,
+                0x00,0x0c,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+                0x11,0x00,0x07,0x00,0x11,0x00,0x0d,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x05,0x00,0x11,0x00,0x05,0x00,0x11,0x00,0x0e,0x00,0x12,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x11,0x00,0x06,0x00,0x11,0x00,
+                0x0f,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x11,
+                0x00,0x07,0x00,0x11,0x00,0x10,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x09,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,
+                0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x00,0x03,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,
+                0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x12,
+                0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,
+                0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x19,0x00,0x11,0x00,
+                0x1b,0x00,0x11,0x00,0x13,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x11,0x00,0x14,0x00,0x12,0x00,0x00,0x02,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x19,0x00,
+                0x11,0x00,0x1b,0x00,0x11,0x00,0x15,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x09,0x00,0x11,0x00,0x16,0x00,0x12,0x00,0x00,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x11,0x00,0x0a,0x00,0x11,0x00,
+                0x17,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x11,
+                0x00,0x0b,0x00,0x11,0x00,0x18,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x0c,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x19,0x00,0x12,0x00,0x00,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x00,0x11,0x00,0x1a,0x00,0x11,0x00,0x1a,
+                0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x11,0x00,
+                0x1b,0x00,0x11,0x00,0x1b,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x19,0x00,0x11,0x00,0x19,0x00,0x11,0x00,0x1c,0x00,0x12,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x11,0x00,0x17,0x00,0x11,0x00,0x1d,0x00,
+                0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,
+                0x00,0x12,0x00,0x1e,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x14,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x1f,0x00,0x12,0x00,0x00,0x01,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x11,0x00,0x15,0x00,0x11,0x00,0x20,0x00,0x12,
+                0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00,0x11,0x00,0x16,0x00,
+                0x11,0x00,0x21,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+                0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x22,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x00,0x12,0x00,0x11,0x00,0x12,0x00,0x11,0x00,0x23,0x00,0x12,0x00,
+                0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x11,0x00,0x13,0x00,0x11,
+                0x00,0x24,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+                0x11,0x00,0x02,0x00,0x12,0x00,0x25,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x26,0x00,0x12,0x00,0x01,
+                0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,0x00,
+                0x27,0x00,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x11,
+                0x00,0x08,0x00,0x11,0x00,0x28,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x29,0x00,0x12,0x00,0x01,0x01,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2a,
+                0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,
+                0x02,0x00,0x12,0x00,0x2b,0x00,0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x00,0x01,0x00,0x11,0x00,0x02,0x00,0x12,0x00,0x2c,0x00,0x12,0x00,0x00,0x01,0x00,
+                0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x11,0x00,0x10,0x00,0x11,0x00,0x2d,0x00,
+                0x12,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x00,0x02,
+                0x00,0x12,0x00,0x2e,0x00,0x12,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                0x08,0x00,0x11,0x00,0x0c,0x00,0x11,0x00,0x14,0x00,0x11,0x00,0x17,0x00,0x11,0x00,
+                0x19,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,
+            };
+            static constexpr std::span<const uint8_t> get_image() noexcept {
+                return image;
+            }
+            static constexpr std::optional<size_t> predict_lpr(taul::symbol_id nonterminal, taul::symbol_id terminal) noexcept {
+                [[maybe_unused]] const auto t = taul::symbol_id_num(terminal);
+                switch (taul::symbol_id_num(nonterminal)) {
+                case 0x110001: { // END_OF_KW
+                    switch (t) {
+                    case 0x3a: case 0x3b: case 0x3c: case 0x3d: case 0x3e: case 0x3f: case 0x40: return 0;
+                    case 0x5b: case 0x5c: case 0x5d: case 0x5e: return 0;
+                    case 0x60: return 0;
+                    case 0x110000: return 6;
+                    default: break;
+                    }
+                    if (t <= 0x2f) return 0;
+                    if (t >= 0x7b && t <= 0x10ffff) return 0;
+                    return std::nullopt;
+                }
+                case 0x110002: { // KW_LEXER
+                    switch (t) {
+                    case 0x6c: return 7;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110003: { // KW_PARSER
+                    switch (t) {
+                    case 0x70: return 8;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110004: { // KW_SECTION
+                    switch (t) {
+                    case 0x73: return 9;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110005: { // KW_SKIP
+                    switch (t) {
+                    case 0x73: return 10;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110006: { // KW_SUPPORT
+                    switch (t) {
+                    case 0x73: return 11;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110007: { // KW_PRECEDENCE
+                    switch (t) {
+                    case 0x70: return 12;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110008: { // KW_RIGHT_ASSOC
+                    switch (t) {
+                    case 0x72: return 13;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110009: { // KW_END
+                    switch (t) {
+                    case 0x65: return 14;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000a: { // KW_ANY
+                    switch (t) {
+                    case 0x61: return 15;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000b: { // KW_TOKEN
+                    switch (t) {
+                    case 0x74: return 16;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000c: { // KW_FAILURE
+                    switch (t) {
+                    case 0x66: return 17;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000d: { // OP_PERIOD
+                    switch (t) {
+                    case 0x2e: return 18;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000e: { // OP_COLON
+                    switch (t) {
+                    case 0x3a: return 19;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11000f: { // OP_SEMICOLON
+                    switch (t) {
+                    case 0x3b: return 20;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110010: { // OP_VBAR
+                    switch (t) {
+                    case 0x7c: return 21;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110011: { // OP_QUESTION
+                    switch (t) {
+                    case 0x3f: return 22;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110012: { // OP_ASTERISK
+                    switch (t) {
+                    case 0x2a: return 23;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110013: { // OP_PLUS
+                    switch (t) {
+                    case 0x2b: return 24;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110014: { // OP_AMPERSAND
+                    switch (t) {
+                    case 0x26: return 25;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110015: { // OP_MINUS
+                    switch (t) {
+                    case 0x2d: return 26;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110016: { // OP_TILDE
+                    switch (t) {
+                    case 0x7e: return 27;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110017: { // OP_L_ROUND
+                    switch (t) {
+                    case 0x28: return 28;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110018: { // OP_R_ROUND
+                    switch (t) {
+                    case 0x29: return 29;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110019: { // IDENTIFIER
+                    switch (t) {
+                    case 0x5f: return 30;
+                    default: break;
+                    }
+                    if (t >= 0x41 && t <= 0x5a) return 30;
+                    if (t >= 0x61 && t <= 0x7a) return 30;
+                    return std::nullopt;
+                }
+                case 0x11001a: { // STRING
+                    switch (t) {
+                    case 0x27: return 40;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11001b: { // CHARSET
+                    switch (t) {
+                    case 0x5b: return 50;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11001c: { // WHITESPACE
+                    switch (t) {
+                    case 0x9: return 59;
+                    case 0x20: return 59;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11001d: { // NEWLINE
+                    switch (t) {
+                    case 0xa: return 64;
+                    case 0xd: return 65;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11001e: { // COMMENT
+                    switch (t) {
+                    case 0x23: return 68;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11001f: {
+                    switch (t) {
+                    case 0x3a: case 0x3b: case 0x3c: case 0x3d: case 0x3e: case 0x3f: case 0x40: return 2;
+                    case 0x5b: case 0x5c: case 0x5d: case 0x5e: return 3;
+                    case 0x60: return 4;
+                    default: break;
+                    }
+                    if (t <= 0x2f) return 1;
+                    if (t >= 0x7b && t <= 0x10ffff) return 5;
+                    return std::nullopt;
+                }
+                case 0x110020: {
+                    switch (t) {
+                    case 0x5f: return 32;
+                    default: break;
+                    }
+                    if (t >= 0x41 && t <= 0x5a) return 31;
+                    if (t >= 0x61 && t <= 0x7a) return 33;
+                    return std::nullopt;
+                }
+                case 0x110021: {
+                    switch (t) {
+                    case 0x3a: case 0x3b: case 0x3c: case 0x3d: case 0x3e: case 0x3f: case 0x40: return 34;
+                    case 0x5b: case 0x5c: case 0x5d: case 0x5e: return 34;
+                    case 0x5f: return 35;
+                    case 0x60: return 34;
+                    default: break;
+                    }
+                    if (t < 0x41) {
+                        if (t <= 0x2f) return 34;
+                        if (t >= 0x30 && t <= 0x39) return 35;
+                    }
+                    else {
+                        if (t < 0x61) {
+                            if (t >= 0x41 && t <= 0x5a) return 35;
+                        }
+                        else {
+                            if (t >= 0x61 && t <= 0x7a) return 35;
+                            if (t >= 0x7b && t <= 0x110000) return 34;
+                        }
+                    }
+                    return std::nullopt;
+                }
+                case 0x110022: {
+                    switch (t) {
+                    case 0x5f: return 38;
+                    default: break;
+                    }
+                    if (t < 0x41) {
+                        if (t >= 0x30 && t <= 0x39) return 36;
+                    }
+                    else {
+                        if (t >= 0x41 && t <= 0x5a) return 37;
+                        if (t >= 0x61 && t <= 0x7a) return 39;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110023: {
+                    switch (t) {
+                    case 0x27: return 41;
+                    case 0x110000: return 41;
+                    default: break;
+                    }
+                    if (t <= 0x26) return 42;
+                    if (t >= 0x28 && t <= 0x10ffff) return 42;
+                    return std::nullopt;
+                }
+                case 0x110024: {
+                    switch (t) {
+                    case 0x5c: return 43;
+                    default: break;
+                    }
+                    if (t < 0x28) {
+                        if (t <= 0x26) return 44;
+                    }
+                    else {
+                        if (t >= 0x28 && t <= 0x5b) return 44;
+                        if (t >= 0x5d && t <= 0x10ffff) return 44;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110025: {
+                    if (t < 0x28) {
+                        if (t <= 0x26) return 45;
+                    }
+                    else {
+                        if (t >= 0x28 && t <= 0x5b) return 46;
+                        if (t >= 0x5d && t <= 0x10ffff) return 47;
+                    }
+                    return std::nullopt;
+                }
+                case 0x110026: {
+                    switch (t) {
+                    case 0x27: return 49;
+                    default: break;
+                    }
+                    if (t <= 0x26) return 48;
+                    if (t >= 0x28 && t <= 0x110000) return 48;
+                    return std::nullopt;
+                }
+                case 0x110027: {
+                    switch (t) {
+                    case 0x5d: return 51;
+                    case 0x110000: return 51;
+                    default: break;
+                    }
+                    if (t <= 0x5c) return 52;
+                    if (t >= 0x5e && t <= 0x10ffff) return 52;
+                    return std::nullopt;
+                }
+                case 0x110028: {
+                    switch (t) {
+                    case 0x5c: return 53;
+                    default: break;
+                    }
+                    if (t <= 0x5b) return 54;
+                    if (t >= 0x5e && t <= 0x10ffff) return 54;
+                    return std::nullopt;
+                }
+                case 0x110029: {
+                    if (t <= 0x5b) return 55;
+                    if (t >= 0x5e && t <= 0x10ffff) return 56;
+                    return std::nullopt;
+                }
+                case 0x11002a: {
+                    switch (t) {
+                    case 0x5d: return 58;
+                    default: break;
+                    }
+                    if (t <= 0x5c) return 57;
+                    if (t >= 0x5e && t <= 0x110000) return 57;
+                    return std::nullopt;
+                }
+                case 0x11002c: {
+                    switch (t) {
+                    case 0x9: return 61;
+                    case 0x20: return 61;
+                    default: break;
+                    }
+                    if (t < 0xa) {
+                        if (t <= 0x8) return 60;
+                    }
+                    else {
+                        if (t >= 0xa && t <= 0x1f) return 60;
+                        if (t >= 0x21 && t <= 0x110000) return 60;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11002e: {
+                    switch (t) {
+                    case 0x9: return 62;
+                    case 0x20: return 63;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x11002f: {
+                    switch (t) {
+                    case 0xa: return 67;
+                    default: break;
+                    }
+                    if (t <= 0x9) return 66;
+                    if (t >= 0xb && t <= 0x110000) return 66;
+                    return std::nullopt;
+                }
+                case 0x110030: {
+                    switch (t) {
+                    case 0xa: return 69;
+                    case 0xb: case 0xc: return 70;
+                    case 0xd: return 69;
+                    case 0x110000: return 69;
+                    default: break;
+                    }
+                    if (t <= 0x9) return 70;
+                    if (t >= 0xe && t <= 0x10ffff) return 70;
+                    return std::nullopt;
+                }
+                case 0x110031: {
+                    switch (t) {
+                    case 0xb: case 0xc: return 72;
+                    default: break;
+                    }
+                    if (t <= 0x9) return 71;
+                    if (t >= 0xe && t <= 0x10ffff) return 73;
+                    return std::nullopt;
+                }
+                default: return std::nullopt;
+                }
+            }
+            static constexpr std::optional<size_t> predict_ppr(taul::symbol_id nonterminal, taul::symbol_id terminal) noexcept {
+                [[maybe_unused]] const auto t = taul::symbol_id_num(terminal);
+                switch (taul::symbol_id_num(nonterminal)) {
+                case 0x120003: { // Spec
+                    switch (t) {
+                    case 0x110002: case 0x110003: return 0;
+                    case 0x110005: case 0x110006: case 0x110007: return 0;
+                    case 0x110019: return 0;
+                    case 0x120002: return 0;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120004: { // Clause
+                    switch (t) {
+                    case 0x110002: return 3;
+                    case 0x110003: return 4;
+                    case 0x110005: case 0x110006: case 0x110007: return 5;
+                    case 0x110019: return 5;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120005: { // LexerSection
+                    switch (t) {
+                    case 0x110002: return 6;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120006: { // ParserSection
+                    switch (t) {
+                    case 0x110003: return 7;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120007: { // Rule
+                    switch (t) {
+                    case 0x110005: case 0x110006: case 0x110007: return 8;
+                    case 0x110019: return 8;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120008: { // Rule_Qualifiers
+                    if (t >= 0x110001 && t <= 0x120002) return 9;
+                    return std::nullopt;
+                }
+                case 0x120009: { // Rule_Name
+                    switch (t) {
+                    case 0x110019: return 10;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12000a: { // Rule_Alts
+                    if (t >= 0x110001 && t <= 0x120002) return 11;
+                    return std::nullopt;
+                }
+                case 0x12000b: { // Qualifiers
+                    if (t >= 0x110001 && t <= 0x120002) return 12;
+                    return std::nullopt;
+                }
+                case 0x12000c: { // Qualifier
+                    switch (t) {
+                    case 0x110005: return 15;
+                    case 0x110006: return 16;
+                    case 0x110007: return 17;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12000d: { // Qualifier_Skip
+                    switch (t) {
+                    case 0x110005: return 18;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12000e: { // Qualifier_Support
+                    switch (t) {
+                    case 0x110006: return 19;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12000f: { // Qualifier_Precedence
+                    switch (t) {
+                    case 0x110007: return 20;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120010: { // Expr
+                    switch (t) {
+                    case 0x110009: case 0x11000a: case 0x11000b: case 0x11000c: return 21;
+                    case 0x110014: case 0x110015: case 0x110016: case 0x110017: return 21;
+                    case 0x110019: case 0x11001a: case 0x11001b: return 21;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120011: { // Expr_NoSuffix
+                    switch (t) {
+                    case 0x110009: case 0x11000a: case 0x11000b: case 0x11000c: return 24;
+                    case 0x110014: case 0x110015: case 0x110016: case 0x110017: return 24;
+                    case 0x110019: case 0x11001a: case 0x11001b: return 24;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120012: { // Base
+                    switch (t) {
+                    case 0x110009: case 0x11000a: case 0x11000b: case 0x11000c: return 25;
+                    case 0x110014: return 27;
+                    case 0x110015: return 28;
+                    case 0x110016: return 29;
+                    case 0x110017: return 26;
+                    case 0x110019: case 0x11001a: case 0x11001b: return 25;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120013: { // Suffix
+                    switch (t) {
+                    case 0x110011: return 30;
+                    case 0x110012: return 31;
+                    case 0x110013: return 32;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120014: { // Primary
+                    switch (t) {
+                    case 0x110009: return 33;
+                    case 0x11000a: return 34;
+                    case 0x11000b: return 35;
+                    case 0x11000c: return 36;
+                    case 0x110019: return 39;
+                    case 0x11001a: return 37;
+                    case 0x11001b: return 38;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120015: { // End
+                    switch (t) {
+                    case 0x110009: return 40;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120016: { // Any
+                    switch (t) {
+                    case 0x11000a: return 41;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120017: { // Token
+                    switch (t) {
+                    case 0x11000b: return 42;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120018: { // Failure
+                    switch (t) {
+                    case 0x11000c: return 43;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120019: { // String
+                    switch (t) {
+                    case 0x11001a: return 44;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12001a: { // Charset
+                    switch (t) {
+                    case 0x11001b: return 45;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12001b: { // Name
+                    switch (t) {
+                    case 0x110019: return 46;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12001c: { // Sequence
+                    switch (t) {
+                    case 0x110017: return 47;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12001d: { // Sequence_Alts
+                    if (t >= 0x110001 && t <= 0x120002) return 48;
+                    return std::nullopt;
+                }
+                case 0x12001e: { // LookAhead
+                    switch (t) {
+                    case 0x110014: return 49;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12001f: { // LookAheadNot
+                    switch (t) {
+                    case 0x110015: return 50;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120020: { // Not
+                    switch (t) {
+                    case 0x110016: return 51;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120021: { // Optional_Suffix
+                    switch (t) {
+                    case 0x110011: return 52;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120022: { // KleeneStar_Suffix
+                    switch (t) {
+                    case 0x110012: return 53;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120023: { // KleenePlus_Suffix
+                    switch (t) {
+                    case 0x110013: return 54;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120024: { // Alts
+                    if (t >= 0x110001 && t <= 0x120002) return 55;
+                    return std::nullopt;
+                }
+                case 0x120025: { // Alt_Divider
+                    switch (t) {
+                    case 0x110010: return 59;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120026: { // Alt
+                    if (t >= 0x110001 && t <= 0x120002) return 60;
+                    return std::nullopt;
+                }
+                case 0x120027: { // RightAssoc
+                    switch (t) {
+                    case 0x110008: return 65;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x120028: {
+                    switch (t) {
+                    case 0x110001: return 1;
+                    case 0x110002: case 0x110003: return 2;
+                    case 0x110004: return 1;
+                    case 0x110005: case 0x110006: case 0x110007: return 2;
+                    case 0x110019: return 2;
+                    default: break;
+                    }
+                    if (t >= 0x110008 && t <= 0x110018) return 1;
+                    if (t >= 0x11001a && t <= 0x120002) return 1;
+                    return std::nullopt;
+                }
+                case 0x120029: {
+                    switch (t) {
+                    case 0x110001: case 0x110002: case 0x110003: case 0x110004: return 13;
+                    case 0x110005: case 0x110006: case 0x110007: return 14;
+                    default: break;
+                    }
+                    if (t >= 0x110008 && t <= 0x120002) return 13;
+                    return std::nullopt;
+                }
+                case 0x12002a: {
+                    switch (t) {
+                    case 0x110011: case 0x110012: case 0x110013: return 23;
+                    default: break;
+                    }
+                    if (t >= 0x110001 && t <= 0x110010) return 22;
+                    if (t >= 0x110014 && t <= 0x120002) return 22;
+                    return std::nullopt;
+                }
+                case 0x12002b: {
+                    switch (t) {
+                    case 0x110010: return 57;
+                    default: break;
+                    }
+                    if (t >= 0x110001 && t <= 0x11000f) return 56;
+                    if (t >= 0x110011 && t <= 0x120002) return 56;
+                    return std::nullopt;
+                }
+                case 0x12002c: {
+                    switch (t) {
+                    case 0x110010: return 58;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                case 0x12002d: {
+                    switch (t) {
+                    case 0x110001: case 0x110002: case 0x110003: case 0x110004: case 0x110005: case 0x110006: case 0x110007: return 61;
+                    case 0x110008: case 0x110009: case 0x11000a: case 0x11000b: case 0x11000c: return 62;
+                    case 0x11000d: case 0x11000e: case 0x11000f: case 0x110010: case 0x110011: case 0x110012: case 0x110013: return 61;
+                    case 0x110014: case 0x110015: case 0x110016: case 0x110017: return 62;
+                    case 0x110018: return 61;
+                    case 0x110019: case 0x11001a: case 0x11001b: return 62;
+                    default: break;
+                    }
+                    if (t >= 0x11001c && t <= 0x120002) return 61;
+                    return std::nullopt;
+                }
+                case 0x12002e: {
+                    switch (t) {
+                    case 0x110008: return 64;
+                    case 0x110009: case 0x11000a: case 0x11000b: case 0x11000c: return 63;
+                    case 0x110014: case 0x110015: case 0x110016: case 0x110017: return 63;
+                    case 0x110019: case 0x11001a: case 0x11001b: return 63;
+                    default: break;
+                    }
+                    return std::nullopt;
+                }
+                default: return std::nullopt;
+                }
             }
         };
     }
@@ -56,6 +56,34 @@ void taul::lexer::reset() {
     return _reset();
 }
 
+bool taul::lexer::limit_exceeded() const noexcept {
+    return _limit_exceeded;
+}
+
+void taul::lexer::limit(size_t max_lookahead) {
+    _max_lookahead = max_lookahead;
+}
+
+taul::lexer::checkpoint_t taul::lexer::checkpoint() const {
+    checkpoint_t result{};
+    result._recorded_inputs = _input.recorded_inputs;
+    result._current_input = _input.current_input;
+    result._total_forgot = _input.total_forgot;
+    _puller.save(result);
+    result._latest = _latest;
+    result._limit_exceeded = _limit_exceeded;
+    return result;
+}
+
+void taul::lexer::restore(const checkpoint_t& cp) {
+    _input.recorded_inputs = cp._recorded_inputs; // <- copy assign, reusing memory
+    _input.current_input = cp._current_input;
+    _input.total_forgot = cp._total_forgot;
+    _puller.load(cp);
+    _latest = cp._latest;
+    _limit_exceeded = cp._limit_exceeded;
+}
+
 taul::lexer& taul::lexer::input_queue::self() const noexcept {
     TAUL_ASSERT(_self);
     return *_self;
@@ -91,8 +119,17 @@ void taul::lexer::input_queue::forget() {
 taul::glyph taul::lexer::input_queue::peek() {
     TAUL_ASSERT(current_input <= recorded_inputs.size());
     if (current_input == recorded_inputs.size()) {
+        // upon exceeding the lookahead limit, record an end-of-input glyph in place
+        // of pulling from upstream, w/ the lexer thereafter never pulling again
+        const bool exceeded = self()._limit_exceeded || recorded_inputs.size() >= self()._max_lookahead;
         // lexer impl must not call peek/next w/out source!
-        TAUL_DEREF_SAFE(self()._source) recorded_inputs.push_back(self()._source->next());
+        TAUL_DEREF_SAFE(self()._source) {
+            if (exceeded) {
+                self()._limit_exceeded = true;
+                recorded_inputs.push_back(glyph::end(self()._source->peek().pos));
+            }
+            else recorded_inputs.push_back(self()._source->next());
+        }
     }
     return recorded_inputs[current_input];
 }
@@ -123,12 +160,12 @@ taul::token taul::lexer::matcher::match(lpr_ref start_rule) {
     return _result;
 }
 
-const taul::internal::nonterminal_id_allocs<taul::glyph>& taul::lexer::matcher::_policy::fetch_ntia(grammar x) {
-    return internal::launder_grammar_data(x)._lpr_id_allocs;
+const taul::internal::nonterminal_id_allocs<taul::glyph>& taul::lexer::matcher::_policy::fetch_ntia(const internal::grammar_data& x) {
+    return x._lpr_id_allocs;
 }
 
-const taul::internal::parse_table<taul::glyph>& taul::lexer::matcher::_policy::fetch_pt(grammar x) {
-    return internal::launder_grammar_data(x)._lpr_pt;
+const taul::internal::parse_table<taul::glyph>& taul::lexer::matcher::_policy::fetch_pt(const internal::grammar_data& x) {
+    return x._lpr_pt;
 }
 
 taul::glyph taul::lexer::matcher::_policy::peek() {
@@ -219,6 +256,18 @@ void taul::lexer::puller::reset() {
     _last_pending_consumed_no_input = false;
 }
 
+void taul::lexer::puller::save(checkpoint_t& cp) const {
+    cp._current = _current;
+    cp._pending = _pending;
+    cp._last_pending_consumed_no_input = _last_pending_consumed_no_input;
+}
+
+void taul::lexer::puller::load(const checkpoint_t& cp) {
+    _current = cp._current;
+    _pending = cp._pending;
+    _last_pending_consumed_no_input = cp._last_pending_consumed_no_input;
+}
+
 bool taul::lexer::puller::_at_end_of_input() {
     return self()._input.peek().is_end();
 }
@@ -376,6 +425,7 @@ void taul::lexer::_reset() {
     _input.reset();
     _puller.reset();
     _latest.reset();
+    _limit_exceeded = false;
     if (_source) _source->reset();
     _valid = true;
 }
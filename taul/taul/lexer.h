@@ -4,6 +4,7 @@
 
 
 #include "base_lexer.h"
+#include "parse_limits.h"
 
 #include "internal/parse_table.h"
 #include "internal/parsing_system.h"
@@ -28,6 +29,33 @@ namespace taul {
         token next() override final;
         bool done() override final;
         void reset() override final;
+        bool limit_exceeded() const noexcept override final;
+
+
+        // limit sets the max number of glyphs the lexer may buffer ahead
+        // while resolving a token (see parse_limits::max_lookahead)
+
+        // upon exceeding it, the lexer treats input as having ended, w/
+        // limit_exceeded returning true until the lexer is reset
+
+        void limit(size_t max_lookahead);
+
+
+        class checkpoint_t;
+
+        // checkpoint/restore are used to capture, and later restore, the
+        // state of the lexer, such that lexing may resume from where the
+        // checkpoint was taken
+
+        // behaviour is undefined if checkpoint is called while the lexer
+        // is in the middle of producing a token (ie. from its observer)
+
+        // checkpoints do not include the state of the upstream glyph stream,
+        // w/ the end-user being responsible for capturing/restoring it 
+        // alongside the lexer (see source_reader::checkpoint)
+
+        checkpoint_t checkpoint() const;
+        void restore(const checkpoint_t& cp);
 
 
     private:
@@ -135,10 +163,12 @@ namespace taul {
             struct _policy final {
                 using symbol_type = glyph;
                 using rule_ref_type = lpr_ref;
-                static const internal::nonterminal_id_allocs<symbol_type>& fetch_ntia(grammar x);
-                static const internal::parse_table<symbol_type>& fetch_pt(grammar x);
+                static const internal::nonterminal_id_allocs<symbol_type>& fetch_ntia(const internal::grammar_data& x);
+                static const internal::parse_table<symbol_type>& fetch_pt(const internal::grammar_data& x);
                 symbol_type peek();
                 symbol_type next();
+                inline bool input_ready() { return true; }
+                inline bool input_complete() { return true; }
                 void reinit_output(rule_ref_type start_rule);
                 std::string fmt_output() const;
                 void output_startup();
@@ -146,6 +176,8 @@ namespace taul {
                 void output_terminal(symbol_type terminal);
                 void output_nonterminal_begin(symbol_id);
                 void output_nonterminal_end();
+                inline bool try_reuse_nonterminal(symbol_id, symbol_type) { return false; }
+                inline bool try_defer_nonterminal(symbol_id, symbol_type) { return false; }
                 void output_terminal_error(symbol_range<symbol_type> ids, symbol_type input);
                 void output_nonterminal_error(symbol_id id, symbol_type input);
                 static constexpr bool uses_eh() noexcept { return false; }
@@ -154,6 +186,7 @@ namespace taul {
                 inline void eh_terminal_error(symbol_range<symbol_type>, symbol_type) {}
                 inline void eh_nonterminal_error(symbol_id, symbol_type) {}
                 inline void eh_recovery_failed() {}
+                inline bool within_limits(size_t) { return true; }
 
 
                 lexer* _self_ptr = nullptr; // link to _self
@@ -186,6 +219,9 @@ namespace taul {
 
             void reset(); // reset as part of pipeline reset
 
+            void save(checkpoint_t& cp) const; // write state to cp
+            void load(const checkpoint_t& cp); // read state from cp
+
 
         private:
 
@@ -221,6 +257,9 @@ namespace taul {
         matcher _matcher;
         puller _puller;
 
+        size_t _max_lookahead = no_limit;
+        bool _limit_exceeded = false;
+
         static constexpr size_t _reserved_mem_for_input_cache = 64;
         static constexpr size_t _reserved_mem_for_matcher_stack = 32;
 
@@ -241,5 +280,22 @@ namespace taul {
         bool _done();
         void _reset();
     };
+
+    class lexer::checkpoint_t final {
+    public:
+
+        friend class lexer;
+
+
+    private:
+
+        std::vector<glyph> _recorded_inputs;
+        size_t _current_input = 0;
+        size_t _total_forgot = 0;
+        std::optional<token> _current, _pending;
+        bool _last_pending_consumed_no_input = false;
+        std::optional<token> _latest;
+        bool _limit_exceeded = false;
+    };
 }
 
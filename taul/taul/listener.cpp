@@ -2,6 +2,8 @@
 
 #include "listener.h"
 
+#include "asserts.h"
+
 
 taul::listener::listener(std::shared_ptr<logger> lgr) 
     : api_component(lgr) {}
@@ -39,3 +41,66 @@ void taul::listener::playback(const parse_tree& x) {
     on_shutdown();
 }
 
+
+void taul::listener::playback(const parse_tree& x, const playback_filter& filter) {
+    TAUL_ASSERT(filter);
+    on_startup();
+    // nodestk only tracks syntactic nodes which were reported
+    std::vector<std::size_t> nodestk{};
+    // subtree_end is the index just past the end of the subtree which is
+    // currently being reported in its entirety, if any
+    std::size_t subtree_end = 0;
+    std::size_t i = 0;
+    while (i < x.nodes()) {
+        const auto& I = x.at(i);
+        while (!nodestk.empty()) {
+            const auto& nd = x.at(nodestk.back());
+            if (I.level() > nd.level()) break;
+            on_close();
+            nodestk.pop_back();
+        }
+        const playback_action action =
+            i < subtree_end
+            ? playback_action::report
+            : filter(I);
+        if (action == playback_action::skip) {
+            // skipping past the subtree means jumping to the node after its
+            // last descendant, which we find by following right children
+            auto last = x.begin() + i;
+            while (last->has_children()) last = last->right_child();
+            i = last->index() + 1;
+            continue;
+        }
+        if (action == playback_action::report_subtree) {
+            auto last = x.begin() + i;
+            while (last->has_children()) last = last->right_child();
+            subtree_end = last->index() + 1;
+        }
+        if (action != playback_action::descend) {
+            if (I.is_lexical()) on_lexical(I.tkn().value());
+            if (I.is_syntactic()) {
+                on_syntactic(I.ppr().value(), I.pos());
+                nodestk.push_back(I.index());
+            }
+        }
+        i++;
+    }
+    while (!nodestk.empty()) {
+        on_close();
+        nodestk.pop_back();
+    }
+    if (x.is_aborted()) on_abort();
+    on_shutdown();
+}
+
+void taul::listener::playback(const parse_tree& x, const std::unordered_set<symbol_id>& ids) {
+    auto filter =
+        [&ids](const parse_tree::node& nd) -> playback_action {
+        if (ids.contains(nd.id())) return playback_action::report_subtree;
+        return
+            nd.is_syntactic()
+            ? playback_action::descend
+            : playback_action::skip;
+        };
+    playback(x, filter);
+}
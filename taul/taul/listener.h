@@ -3,6 +3,10 @@
 #pragma once
 
 
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
 #include "str.h"
 #include "source_code.h"
 #include "grammar.h"
@@ -14,6 +18,22 @@
 namespace taul {
 
 
+    // playback_action specifies what selective playback is to do
+    // upon visiting a given parse tree node
+
+    enum class playback_action : std::uint8_t {
+        report,         // report the node, then visit its children (if any)
+        report_subtree, // report the node, and its whole subtree, w/out further filtering
+        descend,        // don't report the node, but still visit its children (if any)
+        skip,           // don't report the node, nor anything in its subtree
+    };
+
+    // playback_filter is the callback used by selective playback to decide
+    // what to do w/ each node it visits
+
+    using playback_filter = std::function<playback_action(const parse_tree::node&)>;
+
+
     // the listener is a component of the parser which, in a push-based
     // manner, receives information about the parse tree resolved during
     // the parsing process, in a depth-first manner, this information
@@ -37,6 +57,27 @@ namespace taul {
 
         void playback(const parse_tree& tree);
 
+        // these overloads perform *selective* playback, w/ only a subset
+        // of the tree's nodes being reported
+
+        // skipped subtrees are jumped over in their entirety, w/out their
+        // nodes being visited one-by-one
+
+        // on_close events arise only for reported syntactic nodes, and
+        // on_startup/on_abort/on_shutdown arise as they would normally
+
+        // this overload uses filter to decide what to do w/ each node
+
+        // behaviour is undefined if filter is empty
+
+        void playback(const parse_tree& tree, const playback_filter& filter);
+
+        // this overload reports only the subtrees of nodes who's symbol 
+        // IDs are in ids, descending into other syntactic nodes, and 
+        // skipping other lexical nodes
+
+        void playback(const parse_tree& tree, const std::unordered_set<symbol_id>& ids);
+
 
         // these events arise upon the vary start and end of listener
         // usage, during parsing or playback
@@ -0,0 +1,188 @@
+
+
+#include "listener_bus.h"
+
+
+taul::listener_bus::_consumer::_consumer(listener* lstnr, std::shared_ptr<listener> lstnr_ownership, overflow_policy policy, size_t capacity)
+    : lstnr(lstnr),
+    lstnr_ownership(std::move(lstnr_ownership)),
+    policy(policy),
+    ring(capacity) {}
+
+taul::listener_bus::listener_bus(std::shared_ptr<logger> lgr)
+    : listener(lgr) {}
+
+taul::listener_bus::~listener_bus() noexcept {
+    for (const auto& c : _consumers) {
+        if (c->dropping && c->round_over) _repay(*c, true);
+        _push(*c, _event{ .type = _event_type::stop });
+        c->ring.publish();
+    }
+    for (const auto& c : _consumers) c->thread.join();
+}
+
+size_t taul::listener_bus::subscribe(listener* consumer, overflow_policy policy, size_t capacity) {
+    return _subscribe(consumer, nullptr, policy, capacity);
+}
+
+size_t taul::listener_bus::subscribe(std::shared_ptr<listener> consumer, overflow_policy policy, size_t capacity) {
+    listener* ptr = consumer.get();
+    return _subscribe(ptr, std::move(consumer), policy, capacity);
+}
+
+size_t taul::listener_bus::consumers() const noexcept {
+    return _consumers.size();
+}
+
+size_t taul::listener_bus::overflows(size_t index) const noexcept {
+    TAUL_ASSERT(index < _consumers.size());
+    return _consumers[index]->overflows;
+}
+
+void taul::listener_bus::flush() {
+    _publish();
+}
+
+void taul::listener_bus::wait() {
+    for (const auto& c : _consumers) {
+        if (c->dropping && c->round_over) _repay(*c, true);
+    }
+    _publish();
+    for (const auto& c : _consumers) {
+        for (size_t processed = c->processed.load(); processed != c->sent; processed = c->processed.load()) {
+            c->processed.wait(processed);
+        }
+    }
+}
+
+void taul::listener_bus::on_startup() {
+    _send(_event{ .type = _event_type::startup });
+}
+
+void taul::listener_bus::on_shutdown() {
+    _send(_event{ .type = _event_type::shutdown });
+    _publish();
+}
+
+void taul::listener_bus::on_lexical(token tkn) {
+    _send(_event{ .type = _event_type::lexical, .tkn = tkn });
+}
+
+void taul::listener_bus::on_syntactic(ppr_ref ppr, source_pos pos) {
+    _send(_event{ .type = _event_type::syntactic, .ppr = ppr, .pos = pos });
+}
+
+void taul::listener_bus::on_close() {
+    _send(_event{ .type = _event_type::close });
+}
+
+void taul::listener_bus::on_abort() {
+    _send(_event{ .type = _event_type::abort });
+    _publish();
+}
+
+void taul::listener_bus::on_terminal_error(token_range ids, token input) {
+    _send(_event{ .type = _event_type::terminal_error, .tkn = input, .ids = ids });
+}
+
+void taul::listener_bus::on_nonterminal_error(symbol_id id, token input) {
+    _send(_event{ .type = _event_type::nonterminal_error, .tkn = input, .id = id });
+}
+
+size_t taul::listener_bus::_subscribe(listener* consumer, std::shared_ptr<listener> ownership, overflow_policy policy, size_t capacity) {
+    TAUL_ASSERT(consumer);
+    auto c = std::make_unique<_consumer>(consumer, std::move(ownership), policy, capacity);
+    c->thread = std::thread([ptr = c.get()] { _consume(*ptr); });
+    _consumers.push_back(std::move(c));
+    return _consumers.size() - 1;
+}
+
+void taul::listener_bus::_send(const _event& e) {
+    for (const auto& c : _consumers) _send(*c, e);
+}
+
+void taul::listener_bus::_send(_consumer& c, const _event& e) {
+    if (c.dropping) {
+        if (!c.round_over) {
+            if (e.type == _event_type::shutdown) c.round_over = true;
+            return;
+        }
+        // only reconnect at the start of a round, w/ the new round also
+        // being dropped if the owed events don't fit
+        if (e.type != _event_type::startup) return;
+        if (!_repay(c, false)) {
+            c.round_over = false;
+            c.overflows++;
+            return;
+        }
+    }
+    if (c.policy == overflow_policy::block) _push(c, e);
+    else if (c.ring.try_push(e)) c.sent++;
+    else {
+        c.dropping = true;
+        c.round_over = e.type == _event_type::shutdown;
+        // if the consumer never saw the round start, it's owed nothing
+        c.owed = e.type == _event_type::startup ? 0 : 2;
+        c.overflows++;
+        c.ring.publish();
+        return;
+    }
+    // publish before the ring fills w/ unpublished events, so small capacity
+    // consumers don't overflow needlessly
+    if (c.ring.pending() >= std::min(_batch_size, std::max(c.ring.capacity() / 2, size_t(1)))) c.ring.publish();
+}
+
+void taul::listener_bus::_push(_consumer& c, const _event& e) {
+    while (!c.ring.try_push(e)) c.ring.wait_for_space();
+    c.sent++;
+}
+
+bool taul::listener_bus::_repay(_consumer& c, bool block) {
+    TAUL_ASSERT(c.dropping);
+    for (; c.owed > 0; c.owed--) {
+        const _event e{ .type = c.owed == 2 ? _event_type::abort : _event_type::shutdown };
+        if (block) _push(c, e);
+        else if (c.ring.try_push(e)) c.sent++;
+        else return false;
+    }
+    c.dropping = false;
+    c.round_over = false;
+    return true;
+}
+
+void taul::listener_bus::_publish() {
+    for (const auto& c : _consumers) c->ring.publish();
+}
+
+void taul::listener_bus::_consume(_consumer& c) {
+    size_t processed = 0;
+    while (true) {
+        c.ring.wait_for_data();
+        const _event e = *c.ring.front();
+        c.ring.pop();
+        if (e.type == _event_type::stop) break;
+        _dispatch(deref_assert(c.lstnr), e);
+        processed++;
+        // only update processed once the ring is empty, so we don't
+        // contend w/ the producer over it for every event
+        if (!c.ring.front()) {
+            c.processed.store(processed);
+            c.processed.notify_all();
+        }
+    }
+}
+
+void taul::listener_bus::_dispatch(listener& lstnr, const _event& e) {
+    switch (e.type) {
+    case _event_type::startup:              lstnr.on_startup();                         break;
+    case _event_type::shutdown:             lstnr.on_shutdown();                        break;
+    case _event_type::lexical:              lstnr.on_lexical(e.tkn);                    break;
+    case _event_type::syntactic:            lstnr.on_syntactic(e.ppr.value(), e.pos);   break;
+    case _event_type::close:                lstnr.on_close();                           break;
+    case _event_type::abort:                lstnr.on_abort();                           break;
+    case _event_type::terminal_error:       lstnr.on_terminal_error(e.ids, e.tkn);      break;
+    case _event_type::nonterminal_error:    lstnr.on_nonterminal_error(e.id, e.tkn);    break;
+    default:                                TAUL_DEADEND;                               break;
+    }
+}
+
@@ -0,0 +1,192 @@
+
+
+#pragma once
+
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "listener.h"
+
+#include "internal/spsc_ring.h"
+
+
+namespace taul {
+
+
+    // listener_bus is a listener which *fans out* the events it receives
+    // to any number of *consumer* listeners, each of which runs on its own
+    // thread, receiving events via its own bounded lock-free queue
+
+    // this keeps consumer work off of the parser's thread, and lets each
+    // consumer proceed at its own pace
+
+    // each consumer's queue holds a fixed number of events, bounding the
+    // memory used, w/ each consumer's overflow_policy deciding what to do
+    // when its queue is full (see below)
+
+    // events are published to consumers in batches, w/ consumers seeing
+    // events upon on_shutdown/on_abort, upon flush/wait, or once enough 
+    // events have accumulated
+
+    // consumers see the same sequence of events as the bus, excluding
+    // events dropped due to overflow
+
+    // behaviour is undefined if the bus's events are invoked concurrently,
+    // or if consumers throw
+
+    // behaviour is undefined if a consumer is subscribed more than once,
+    // or is used by anything else while subscribed
+
+
+    class listener_bus final : public listener {
+    public:
+
+        // overflow_policy specifies what to do upon a consumer's queue being full
+
+        enum class overflow_policy : std::uint8_t {
+
+            // block blocks the thread reporting the event until the consumer 
+            // frees up space in its queue (ie. *backpressure*)
+
+            block,
+
+            // drop *disconnects* the consumer for the remainder of the current
+            // round of usage (ie. the events up to on_shutdown), discarding its
+            // events, so a slow consumer doesn't hold up anything else
+
+            // the consumer is reconnected at the start of a later round, once
+            // its queue has space for on_abort and on_shutdown events, which
+            // end the round which was cut short
+
+            drop,
+        };
+
+
+        static constexpr size_t default_capacity = 4096;
+
+
+        listener_bus(std::shared_ptr<logger> lgr = nullptr);
+
+        listener_bus(const listener_bus&) = delete;
+        listener_bus(listener_bus&&) = delete;
+
+        // the destructor waits for consumers to finish their queued events
+
+        virtual ~listener_bus() noexcept;
+
+        listener_bus& operator=(const listener_bus&) = delete;
+        listener_bus& operator=(listener_bus&&) = delete;
+
+
+        // subscribe adds consumer to the bus, starting its thread, w/ capacity
+        // being the number of events its queue may hold, returning its index
+
+        // behaviour is undefined if called between on_startup and on_shutdown
+
+        size_t subscribe(listener* consumer, overflow_policy policy = overflow_policy::block, size_t capacity = default_capacity);
+        size_t subscribe(std::shared_ptr<listener> consumer, overflow_policy policy = overflow_policy::block, size_t capacity = default_capacity);
+
+        // consumers returns the number of consumers subscribed
+
+        size_t consumers() const noexcept;
+
+        // overflows returns the number of rounds of usage during which the
+        // consumer at index had events dropped due to overflow
+
+        // behaviour is undefined if index is out-of-bounds
+
+        size_t overflows(size_t index) const noexcept;
+
+
+        // flush publishes events which have yet to be published to consumers
+
+        void flush();
+
+        // wait flushes, then blocks until all consumers have processed all
+        // events they've been sent
+
+        // consumers disconnected due to overflow are sent the events ending
+        // their cut short round, if said round has ended, blocking if needed
+
+        void wait();
+
+
+        void on_startup() override final;
+        void on_shutdown() override final;
+        void on_lexical(token tkn) override final;
+        void on_syntactic(ppr_ref ppr, source_pos pos) override final;
+        void on_close() override final;
+        void on_abort() override final;
+        void on_terminal_error(token_range ids, token input) override final;
+        void on_nonterminal_error(symbol_id id, token input) override final;
+
+
+    private:
+
+        enum class _event_type : std::uint8_t {
+            startup,
+            shutdown,
+            lexical,
+            syntactic,
+            close,
+            abort,
+            terminal_error,
+            nonterminal_error,
+            stop, // tells the consumer's thread to exit
+        };
+
+        struct _event final {
+            _event_type type = _event_type::stop;
+            token tkn; // for lexical, or the input of errors
+            std::optional<ppr_ref> ppr; // for syntactic
+            source_pos pos = 0; // for syntactic
+            token_range ids; // for terminal_error
+            symbol_id id = symbol_id(0); // for nonterminal_error
+        };
+
+        struct _consumer final {
+            listener* lstnr;
+            std::shared_ptr<listener> lstnr_ownership;
+            overflow_policy policy;
+
+            internal::spsc_ring<_event> ring;
+
+            // these are used only by the producer
+
+            size_t sent = 0; // the number of events pushed
+            size_t overflows = 0;
+            bool dropping = false; // if disconnected due to overflow
+            bool round_over = false; // if the round cut short has since ended
+            size_t owed = 0; // the number of events owed to end the round cut short (ie. on_abort, then on_shutdown)
+
+            alignas(64) std::atomic<size_t> processed = 0; // updated upon the ring being emptied
+
+            std::thread thread;
+
+
+            _consumer(listener* lstnr, std::shared_ptr<listener> lstnr_ownership, overflow_policy policy, size_t capacity);
+        };
+
+
+        std::vector<std::unique_ptr<_consumer>> _consumers;
+
+
+        static constexpr size_t _batch_size = 32;
+
+
+        size_t _subscribe(listener* consumer, std::shared_ptr<listener> ownership, overflow_policy policy, size_t capacity);
+
+        void _send(const _event& e);
+        void _send(_consumer& c, const _event& e);
+        void _push(_consumer& c, const _event& e); // pushes, blocking if full
+        bool _repay(_consumer& c, bool block); // pushes owed events, returning if successful
+        void _publish();
+
+        static void _consume(_consumer& c);
+        static void _dispatch(listener& lstnr, const _event& e);
+    };
+}
+
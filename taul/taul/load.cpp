@@ -2,11 +2,15 @@
 
 #include "load.h"
 
+#include <fstream>
+#include <random>
+
 #include "asserts.h"
 #include "string_and_charset.h"
 #include "compile.h"
 
 #include "internal/loader.h"
+#include "internal/grammar_data.h"
 
 
 std::optional<taul::grammar> taul::load(
@@ -75,10 +79,10 @@ std::optional<taul::grammar> taul::load(
     spec_error_counter& ec, 
     const std::shared_ptr<logger>& lgr,
     bool dbgsyms) {
-    const auto compiled = compile(src_path, lgr, dbgsyms);
+    const auto compiled = compile(src_path, ec, lgr, dbgsyms);
     return
         compiled
-        ? load(*compiled, lgr)
+        ? load(*compiled, ec, lgr)
         : std::nullopt;
 }
 
@@ -93,3 +97,96 @@ std::optional<taul::grammar> taul::load(
         : std::nullopt;
 }
 
+// cache entries are keyed by a 64-bit FNV-1a hash
+
+static constexpr uint64_t _fnv1a_offset_basis = 0xcbf29ce484222325;
+static constexpr uint64_t _fnv1a_prime = 0x100000001b3;
+
+static uint64_t _fnv1a(uint64_t h, std::string_view x) noexcept {
+    for (const auto& I : x) {
+        h ^= uint64_t(uint8_t(I));
+        h *= _fnv1a_prime;
+    }
+    return h;
+}
+
+static std::optional<std::string> _read_file(const std::filesystem::path& path) {
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs.is_open()) return std::nullopt;
+    const size_t file_size = (size_t)ifs.tellg();
+    ifs.seekg(0);
+    std::string result{};
+    result.resize(file_size, '\0');
+    ifs.read(result.data(), file_size);
+    return ifs ? std::make_optional(std::move(result)) : std::nullopt;
+}
+
+static bool _write_file_atomic(const std::filesystem::path& path, std::span<const uint8_t> x) {
+    // write to uniquely named temporary file, then rename it to path, so that
+    // others never observe partially written files
+    const auto temp_path = std::filesystem::path(path).concat(std::format(".{:08x}.tmp", std::random_device{}()));
+    {
+        std::ofstream ofs(temp_path, std::ios::binary | std::ios::trunc);
+        if (!ofs.is_open()) return false;
+        ofs.write((const char*)x.data(), x.size());
+        if (!ofs) {
+            ofs.close();
+            std::error_code ec{};
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+    std::error_code ec{};
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) std::filesystem::remove(temp_path, ec);
+    return !ec;
+}
+
+std::optional<taul::grammar> taul::load_cached(
+    const std::filesystem::path& src_path,
+    const std::filesystem::path& cache_dir,
+    spec_error_counter& ec,
+    const std::shared_ptr<logger>& lgr,
+    bool dbgsyms) {
+    const auto src = _read_file(src_path);
+    if (!src) return load(src_path, ec, lgr, dbgsyms); // <- let load report failure
+    uint64_t key = _fnv1a_offset_basis;
+    key = _fnv1a(key, api_version);
+    key = _fnv1a(key, std::to_string(internal::grammar_data::serialization_version));
+    key = _fnv1a(key, dbgsyms ? "1" : "0");
+    key = _fnv1a(key, *src);
+    const auto entry_path = cache_dir / std::format("{:016x}.taulimg", key);
+    if (const auto image = _read_file(entry_path)) {
+        if (auto result = grammar::from_image(std::span((const uint8_t*)image->data(), image->size()))) {
+            TAUL_LOG(lgr, "loaded grammar from cache entry \"{}\"!", entry_path.string());
+            return result;
+        }
+        TAUL_LOG(lgr, "cache entry \"{}\" is invalid, and will be replaced!", entry_path.string());
+    }
+    // load from the contents we've already read, rather than rereading the
+    // file, so the grammar cached is the one for the contents hashed
+    auto code = std::make_shared<source_code>();
+    code->add_file_contents(src_path, taul::str(*src));
+    auto result = load(code, ec, lgr, dbgsyms);
+    if (result) {
+        std::error_code fs_ec{};
+        std::filesystem::create_directories(cache_dir, fs_ec);
+        if (!fs_ec && _write_file_atomic(entry_path, result->image())) {
+            TAUL_LOG(lgr, "wrote cache entry \"{}\"!", entry_path.string());
+        }
+        else {
+            TAUL_LOG(lgr, "failed to write cache entry \"{}\"!", entry_path.string());
+        }
+    }
+    return result;
+}
+
+std::optional<taul::grammar> taul::load_cached(
+    const std::filesystem::path& src_path,
+    const std::filesystem::path& cache_dir,
+    const std::shared_ptr<logger>& lgr,
+    bool dbgsyms) {
+    spec_error_counter ec{};
+    return load_cached(src_path, cache_dir, ec, lgr, dbgsyms);
+}
+
@@ -61,5 +61,44 @@ namespace taul {
         const std::filesystem::path& src_path,
         const std::shared_ptr<logger>& lgr = nullptr,
         bool dbgsyms = true);
+
+
+    // load_cached wraps usage of load, caching loaded grammars' binary images
+    // (see grammar::image) in files in cache_dir, such that later calls loading
+    // the same spec source can skip compiling/loading it
+
+    // cache entries are keyed by a hash of the spec source, the TAUL library
+    // version, the binary image serialization version, and dbgsyms, w/ edits
+    // to the spec source thus resulting in a cache miss, rather than a stale
+    // grammar being loaded
+
+    // upon a cache miss, the spec source is loaded from the contents read
+    // in order to hash it, rather than src_path being read again
+
+    // cache entries are written to temporary files, which are then renamed,
+    // such that concurrent processes/threads sharing cache_dir never observe
+    // partially written entries
+
+    // cache_dir is created if it does not exist
+
+    // if cache_dir cannot be read/written, or a cache entry cannot be loaded,
+    // load_cached falls back to behaving like load
+
+    // upon a cache hit, ec is not modified, as no compiling/loading occurs
+
+    // these have not been unit tested w/ concurrent usage
+
+    std::optional<grammar> load_cached(
+        const std::filesystem::path& src_path,
+        const std::filesystem::path& cache_dir,
+        spec_error_counter& ec,
+        const std::shared_ptr<logger>& lgr = nullptr,
+        bool dbgsyms = true);
+
+    std::optional<grammar> load_cached(
+        const std::filesystem::path& src_path,
+        const std::filesystem::path& cache_dir,
+        const std::shared_ptr<logger>& lgr = nullptr,
+        bool dbgsyms = true);
 }
 
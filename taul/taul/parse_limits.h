@@ -0,0 +1,51 @@
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <limits>
+
+
+namespace taul {
+
+
+    // parse_limits describes limits on the resources a pipeline may use
+    // while processing a single input, for use w/ untrusted inputs, such
+    // as to stop deeply nested, or otherwise pathological, inputs from
+    // consuming unbounded memory/time
+
+    // upon a limit being exceeded, parsing is aborted, w/ the listener
+    // being reported on_abort, and the parse tree (if any) being marked
+    // as aborted, as occurs upon failed error recovery
+
+    // limits default to no_limit, w/ pipelines which have no limits set
+    // skipping checking them
+
+
+    constexpr size_t no_limit = std::numeric_limits<size_t>::max();
+
+
+    struct parse_limits final {
+        size_t max_depth = no_limit; // max size of the parser's parse stack
+        size_t max_lookahead = no_limit; // max glyphs the lexer may buffer while resolving a token
+        size_t max_nodes = no_limit; // max nodes in the parse tree produced
+        size_t max_recoveries = no_limit; // max error recovery attempts
+        size_t max_steps = no_limit; // max iterations of the parser's main loop
+
+
+        // any returns if any of the limits are set
+
+        constexpr bool any() const noexcept {
+            return
+                max_depth != no_limit ||
+                max_lookahead != no_limit ||
+                max_nodes != no_limit ||
+                max_recoveries != no_limit ||
+                max_steps != no_limit;
+        }
+
+        constexpr bool operator==(const parse_limits&) const noexcept = default;
+    };
+}
+
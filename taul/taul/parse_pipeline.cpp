@@ -0,0 +1,83 @@
+
+
+#include "parse_pipeline.h"
+
+
+taul::parse_pipeline::parse_pipeline(grammar gram, std::shared_ptr<logger> lgr)
+    : api_component(lgr),
+    _reader(),
+    _lexer(gram, lgr),
+    _parser(gram, lgr),
+    _tree(gram) {
+    _lexer.bind_source(&_reader);
+    _parser.bind_source(&_lexer);
+}
+
+void taul::parse_pipeline::bind_listener(listener* listener) {
+    _parser.bind_listener(listener);
+}
+
+void taul::parse_pipeline::bind_listener(std::shared_ptr<listener> listener) {
+    _parser.bind_listener(listener);
+}
+
+void taul::parse_pipeline::bind_error_handler(error_handler* error_handler) {
+    _parser.bind_error_handler(error_handler);
+}
+
+void taul::parse_pipeline::bind_error_handler(std::shared_ptr<error_handler> error_handler) {
+    _parser.bind_error_handler(error_handler);
+}
+
+taul::source_reader& taul::parse_pipeline::get_reader() noexcept {
+    return _reader;
+}
+
+taul::lexer& taul::parse_pipeline::get_lexer() noexcept {
+    return _lexer;
+}
+
+taul::parser& taul::parse_pipeline::get_parser() noexcept {
+    return _parser;
+}
+
+void taul::parse_pipeline::limit(const parse_limits& limits) {
+    _lexer.limit(limits.max_lookahead);
+    _parser.limit(limits);
+}
+
+bool taul::parse_pipeline::limit_exceeded() const noexcept {
+    return _parser.limit_exceeded();
+}
+
+const taul::parse_tree& taul::parse_pipeline::parse(const str& input, ppr_ref start_rule) {
+    _prepare(input);
+    _parser.parse_into(start_rule, _tree);
+    return _tree;
+}
+
+const taul::parse_tree& taul::parse_pipeline::parse(const str& input, const str& name) {
+    _prepare(input);
+    _parser.parse_into(name, _tree);
+    return _tree;
+}
+
+void taul::parse_pipeline::parse_notree(const str& input, ppr_ref start_rule) {
+    _prepare(input);
+    _parser.parse_notree(start_rule);
+}
+
+void taul::parse_pipeline::parse_notree(const str& input, const str& name) {
+    _prepare(input);
+    _parser.parse_notree(name);
+}
+
+const taul::parse_tree& taul::parse_pipeline::tree() const noexcept {
+    return _tree;
+}
+
+void taul::parse_pipeline::_prepare(const str& input) {
+    _reader.change_input(input);
+    _parser.reset(); // <- propagates to _lexer and _reader
+}
+
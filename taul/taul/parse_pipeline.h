@@ -0,0 +1,96 @@
+
+
+#pragma once
+
+
+#include "source_reader.h"
+#include "lexer.h"
+#include "parser.h"
+
+
+namespace taul {
+
+
+    // parse_pipeline bundles a source_reader, lexer and parser into a
+    // reusable pipeline, alongside storage for the parse trees it produces,
+    // w/ the pipeline being re-pointed at new inputs w/out freeing any of
+    // its memory
+
+    // once *warmed up* by parsing inputs at least as large (and as deeply
+    // nested) as later ones, lexing and parsing via parse_notree performs
+    // no heap allocations (provided the listener and error handler used 
+    // do not), w/ parse likewise performing none once its parse tree 
+    // storage has grown large enough
+
+    // parse_pipeline is not thread-safe, w/ each thread needing its own
+
+
+    class parse_pipeline final : public api_component {
+    public:
+
+        parse_pipeline(grammar gram, std::shared_ptr<logger> lgr = nullptr);
+
+        parse_pipeline(const parse_pipeline&) = delete;
+        parse_pipeline(parse_pipeline&&) = delete;
+
+        virtual ~parse_pipeline() noexcept = default;
+
+        parse_pipeline& operator=(const parse_pipeline&) = delete;
+        parse_pipeline& operator=(parse_pipeline&&) = delete;
+
+
+        // these bind the listener/error handler of the internal parser
+
+        void bind_listener(listener* listener);
+        void bind_listener(std::shared_ptr<listener> listener);
+        void bind_error_handler(error_handler* error_handler);
+        void bind_error_handler(std::shared_ptr<error_handler> error_handler);
+
+        // these provide access to the internal components, for configuring 
+        // them (ie. lexer::cut_skip_tokens, parser::omit)
+
+        source_reader& get_reader() noexcept;
+        lexer& get_lexer() noexcept;
+        parser& get_parser() noexcept;
+
+
+        // limit sets the resource limits of the pipeline, w/ parses which
+        // exceed them being aborted (see parse_limits)
+
+        // limit_exceeded returns if the last parse aborted due to this
+
+        void limit(const parse_limits& limits);
+
+        bool limit_exceeded() const noexcept;
+
+
+        // parse parses input, returning the resulting parse tree
+
+        // the parse tree returned is owned by the pipeline, and will be 
+        // overwritten by the next parse call
+
+        const parse_tree& parse(const str& input, ppr_ref start_rule);
+        const parse_tree& parse(const str& input, const str& name);
+
+        // parse_notree parses input, w/out producing a parse tree
+
+        void parse_notree(const str& input, ppr_ref start_rule);
+        void parse_notree(const str& input, const str& name);
+
+        // tree returns the parse tree produced by the last parse call
+
+        const parse_tree& tree() const noexcept;
+
+
+    private:
+
+        source_reader _reader;
+        lexer _lexer;
+        parser _parser;
+        parse_tree _tree;
+
+
+        void _prepare(const str& input);
+    };
+}
+
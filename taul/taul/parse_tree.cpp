@@ -132,6 +132,26 @@ taul::parse_tree& taul::parse_tree::syntactic(const str& name, source_pos pos) {
     return syntactic(_state._gram.ppr(name).value(), pos);
 }
 
+taul::parse_tree& taul::parse_tree::deferred(ppr_ref ppr, source_pos pos, source_len len) {
+    TAUL_ASSERT(_state._gram.is_associated(ppr));
+    TAUL_ASSERT(!is_sealed());
+#if _DUMP_LOG
+    TAUL_LOG(make_stderr_logger(), "taul::parse_tree::deferred({}, {}, {})", ppr, size_t(pos), size_t(len));
+#endif
+    _leaf(ppr.id(), pos, len, _make_ppr_rule(ppr));
+    _mark_latest_node_deferred();
+    return *this;
+}
+
+taul::parse_tree& taul::parse_tree::graft(const node& nd, source_pos offset) {
+    TAUL_ASSERT(!is_sealed());
+#if _DUMP_LOG
+    TAUL_LOG(make_stderr_logger(), "taul::parse_tree::graft({}, {})", nd.index(), size_t(offset));
+#endif
+    _append_copy(nd._get_owner(), nd.index(), _subtree_end(nd), offset);
+    return *this;
+}
+
 taul::parse_tree& taul::parse_tree::close() noexcept {
     TAUL_ASSERT(!is_sealed());
 #if _DUMP_LOG
@@ -150,6 +170,15 @@ taul::parse_tree& taul::parse_tree::skip(source_len len) {
     return *this;
 }
 
+taul::parse_tree& taul::parse_tree::extend(source_pos high_pos) {
+    TAUL_ASSERT(!is_sealed());
+#if _DUMP_LOG
+    TAUL_LOG(make_stderr_logger(), "taul::parse_tree::extend({})", size_t(high_pos));
+#endif
+    _contribute_to_current_high_pos(high_pos);
+    return *this;
+}
+
 taul::parse_tree& taul::parse_tree::abort() {
 #if _DUMP_LOG
     TAUL_LOG(make_stderr_logger(), "taul::parse_tree::abort()");
@@ -158,6 +187,26 @@ taul::parse_tree& taul::parse_tree::abort() {
     return *this;
 }
 
+taul::parse_tree& taul::parse_tree::clear() noexcept {
+    _state._nodes.clear(); // <- keeps capacity
+    _state._current = _no_index;
+    _state._aborted = false;
+    return *this;
+}
+
+taul::parse_tree taul::parse_tree::graft(const node& nd, const parse_tree& subtree) const {
+    TAUL_ASSERT(is_sealed());
+    TAUL_ASSERT(&(nd._get_owner()) == this);
+    TAUL_ASSERT(nd.is_deferred());
+    TAUL_ASSERT(subtree.is_sealed());
+    TAUL_ASSERT(subtree.nodes() > 0);
+    parse_tree result(_state._gram);
+    result._state._nodes.reserve(nodes() + subtree.nodes() - 1);
+    result._append_copy(*this, 0, nodes(), 0, nd.index(), &subtree, nd.pos());
+    if (is_aborted() || subtree.is_aborted()) result.abort();
+    return result;
+}
+
 std::string taul::parse_tree::fmt(const char* tab) const {
     TAUL_ASSERT(tab);
     std::string result{};
@@ -253,6 +302,13 @@ void taul::parse_tree::_contribute_to_current_len(source_len len) {
     current_node._data._len += len;
 }
 
+void taul::parse_tree::_contribute_to_current_high_pos(source_pos high_pos) {
+    TAUL_ASSERT(_has_current());
+    const size_t current_node_index = _state._current;
+    auto& current_node = _state._nodes[current_node_index];
+    current_node._data._len = std::max(high_pos, current_node.high_pos()) - current_node.low_pos();
+}
+
 void taul::parse_tree::_leaf(symbol_id id, source_pos pos, source_len len, std::optional<std::variant<lpr_ref, ppr_ref>> rule) {
     TAUL_ASSERT(!is_sealed());
     _create_latest_node();
@@ -280,6 +336,53 @@ void taul::parse_tree::_mark_abort() {
     _state._aborted = true;
 }
 
+void taul::parse_tree::_mark_latest_node_deferred() {
+    TAUL_ASSERT(!_state._nodes.empty());
+    _state._nodes.back()._data._deferred = true;
+}
+
+void taul::parse_tree::_append_copy(const parse_tree& x, size_t first, size_t last, source_pos offset, size_t replaced, const parse_tree* replacement, source_pos replacement_offset) {
+    TAUL_ASSERT(first <= last);
+    TAUL_ASSERT(last <= x.nodes());
+    // stk tracks the syntactic nodes of x which are open
+    std::vector<size_t> stk{};
+    auto close_top =
+        [&]() {
+        // extend to cover the original source code range, as it may have
+        // been extended beyond that covered by the node's children
+        extend(x.at(stk.back()).high_pos() + offset);
+        close();
+        stk.pop_back();
+        };
+    for (size_t i = first; i < last; i++) {
+        const auto& I = x.at(i);
+        while (!stk.empty() && I.level() <= x.at(stk.back()).level()) close_top();
+        if (I.index() == replaced) {
+            TAUL_DEREF_SAFE(replacement) {
+                _append_copy(*replacement, 0, replacement->nodes(), replacement_offset);
+            }
+        }
+        else if (I.is_lexical()) {
+            auto tkn = I.tkn().value();
+            tkn.pos += offset;
+            lexical(tkn);
+        }
+        else if (I.is_deferred()) deferred(I.ppr().value(), I.pos() + offset, I.len());
+        else {
+            syntactic(I.ppr().value(), I.pos() + offset);
+            stk.push_back(I.index());
+        }
+    }
+    while (!stk.empty()) close_top();
+}
+
+size_t taul::parse_tree::_subtree_end(const node& nd) noexcept {
+    // the last node of nd's subtree is found by following right children
+    const node* last = &nd;
+    while (last->has_children()) last = &*last->right_child();
+    return last->index() + 1;
+}
+
 std::optional<std::variant<taul::lpr_ref, taul::ppr_ref>> taul::parse_tree::_make_no_rule() const {
     return std::nullopt;
 }
@@ -407,6 +510,10 @@ bool taul::parse_tree::node::is_end() const noexcept {
     return is_end_id(id());
 }
 
+bool taul::parse_tree::node::is_deferred() const noexcept {
+    return _data._deferred;
+}
+
 taul::symbol_id taul::parse_tree::node::id() const noexcept {
     return _data._id;
 }
@@ -451,6 +558,7 @@ std::optional<taul::token> taul::parse_tree::node::tkn() const {
 
 std::string taul::parse_tree::node::fmt() const {
     if (is_lexical()) return tkn().value().fmt();
+    else if (is_deferred()) return std::format("{} {} {} (deferred)", fmt_pos_and_len(pos(), len()), id(), ppr().value().name());
     else return std::format("{} {} {}", fmt_pos_and_len(pos(), len()), id(), ppr().value().name());
 }
 
@@ -486,6 +594,7 @@ bool taul::parse_tree::node::_equal(const node& other) const noexcept {
         _data._left_sibling_index == other._data._left_sibling_index &&
         _data._right_sibling_index == other._data._right_sibling_index &&
         _data._children == other._data._children &&
-        _data._right_child_index == other._data._right_child_index;
+        _data._right_child_index == other._data._right_child_index &&
+        _data._deferred == other._data._deferred;
 }
 
@@ -170,6 +170,37 @@ namespace taul {
 
         parse_tree& syntactic(const str& name, source_pos pos);
 
+        // deferred creates a new *placeholder* node, a syntactic node w/out
+        // children which stands in for a subtree of ppr who's parsing was
+        // deferred, making it the root node, or a child of the current node
+
+        // unlike other syntactic nodes, placeholder nodes do not become the
+        // current node, and their len is specified explicitly
+
+        // behaviour is undefined if is_sealed() == true
+
+        // behaviour is undefined if ppr is not part of the parse
+        // tree's associated grammar
+
+        parse_tree& deferred(ppr_ref ppr, source_pos pos, source_len len);
+
+        // graft creates a copy of the subtree rooted at nd, which may be
+        // from another parse_tree, making it the root node, or a child of
+        // the current node
+
+        // the positions of the nodes copied are offset by offset, w/ this
+        // addition being unsigned, such that offsets may be *negative* 
+        // via wraparound
+
+        // whether nd's parse_tree is marked as aborted has no effect
+
+        // behaviour is undefined if is_sealed() == true
+
+        // behaviour is undefined if nd's parse_tree's grammar differs from
+        // the parse tree's associated grammar
+
+        parse_tree& graft(const node& nd, source_pos offset = 0);
+
         // close makes the parent of the current node the current node,
         // sealing the parse_tree if the current node is the root node
 
@@ -184,11 +215,43 @@ namespace taul {
 
         parse_tree& skip(source_len len);
 
+        // extend extends the source code range of the current syntactic
+        // node of the parse tree such that its high_pos() is at least 
+        // high_pos, as though a child node ending at high_pos were added
+
+        // this is used to account for nodes omitted from the parse tree
+
+        // behaviour is undefined if there is no current node
+
+        parse_tree& extend(source_pos high_pos);
+
         // abort marks the parse_tree as being the result of an aborted
         // parsing process
 
         parse_tree& abort();
 
+        // clear removes all nodes, and unmarks the parse_tree as aborted,
+        // w/out freeing its memory, letting it be reused for a new tree
+
+        parse_tree& clear() noexcept;
+
+
+        // graft returns a copy of the parse_tree, w/ the placeholder node
+        // nd replaced by subtree, w/ the positions of subtree's nodes being
+        // offset by nd's pos (see parser::expand)
+
+        // if either the parse_tree or subtree are marked as aborted, the
+        // parse_tree returned will be too
+
+        // behaviour is undefined if is_sealed() == false
+
+        // behaviour is undefined if nd is not a placeholder node of the
+        // parse_tree
+
+        // behaviour is undefined if subtree is empty, or not sealed
+
+        parse_tree graft(const node& nd, const parse_tree& subtree) const;
+
 
         std::string fmt(const char* tab = "    ") const;
 
@@ -237,6 +300,7 @@ namespace taul {
         void _close_current_node();
 
         void _contribute_to_current_len(source_len len);
+        void _contribute_to_current_high_pos(source_pos high_pos);
 
 
         void _leaf(
@@ -254,6 +318,29 @@ namespace taul {
 
         void _mark_abort();
 
+        void _mark_latest_node_deferred();
+
+
+        // _append_copy appends a copy of x's nodes in the index range [first, last),
+        // w/ their positions offset by offset, w/ the node at index replaced (if any) 
+        // being replaced by the nodes of replacement, w/ their positions offset by
+        // replacement_offset
+
+        // [first, last) must be one or more whole subtrees of x
+
+        void _append_copy(
+            const parse_tree& x,
+            size_t first,
+            size_t last,
+            source_pos offset,
+            size_t replaced = _no_index,
+            const parse_tree* replacement = nullptr,
+            source_pos replacement_offset = 0);
+
+        // _subtree_end returns the index just past the end of nd's subtree
+
+        static size_t _subtree_end(const node& nd) noexcept;
+
 
         std::optional<std::variant<lpr_ref, ppr_ref>> _make_no_rule() const;
         std::optional<std::variant<lpr_ref, ppr_ref>> _make_lpr_rule(lpr_ref ref) const;
@@ -317,6 +404,11 @@ namespace taul {
         bool is_failure() const noexcept;
         bool is_end() const noexcept;
 
+        // is_deferred returns if this is a placeholder node for a subtree
+        // who's parsing was deferred
+
+        bool is_deferred() const noexcept;
+
 
         // id returns the symbol ID of the node
 
@@ -373,6 +465,8 @@ namespace taul {
             size_t _children = 0;
 
             size_t _right_child_index = _no_index;
+
+            bool _deferred = false;
         };
 
         data _data;
@@ -3,6 +3,8 @@
 #include "parser.h"
 
 #include "grammar.h"
+#include "source_reader.h"
+#include "lexer.h"
 
 #include "internal/grammar_data.h"
 
@@ -12,17 +14,24 @@ taul::parser::parser(grammar gram, std::shared_ptr<logger> lgr)
     _source(nullptr),
     _listener(nullptr),
     _eh(nullptr),
-    _ps(_policy{ this }, gram, _reserved_mem_for_parse_stack, lgr) {}
+    _omitted_lprs(gram.lprs(), false),
+    _omitted_pprs(gram.pprs(), false),
+    _deferrals(gram.pprs(), std::nullopt),
+    _ps(_policy{ this }, gram, _reserved_mem_for_parse_stack, lgr) {
+    _omitted_stack.reserve(_reserved_mem_for_parse_stack);
+}
 
 void taul::parser::bind_source(token_stream* source) {
     _source = source;
     _source_ownership = nullptr;
+    _push_source = nullptr;
     _valid = false;
 }
 
 void taul::parser::bind_source(std::shared_ptr<token_stream> source) {
     _source = source.get();
     _source_ownership = source;
+    _push_source = nullptr;
     _valid = false;
 }
 
@@ -68,6 +77,15 @@ void taul::parser::parse_notree(const str& name) {
     _parse_notree(gram.ppr(name).value());
 }
 
+void taul::parser::parse_into(ppr_ref start_rule, parse_tree& tree) {
+    _parse_into(start_rule, tree);
+}
+
+void taul::parser::parse_into(const str& name, parse_tree& tree) {
+    TAUL_ASSERT(gram.has_ppr(name));
+    _parse_into(gram.ppr(name).value(), tree);
+}
+
 taul::token taul::parser::eh_peek() {
     return
         _source
@@ -93,18 +111,196 @@ bool taul::parser::eh_check() {
     return _ps.check();
 }
 
+bool taul::parser::eh_recover() {
+    // this checks _ps directly, rather than going through eh_done/eh_check/eh_next,
+    // tho _source's done/next are still each a virtual call per token
+    if (!_source) return false;
+    while (!_source->done()) {
+        if (_ps.check()) return true;
+        _source->next();
+    }
+    return false;
+}
+
 void taul::parser::reset() {
     TAUL_ASSERT(!_result);
     if (_source) _source->reset();
     _valid = true;
 }
 
-const taul::internal::nonterminal_id_allocs<taul::token>& taul::parser::_policy::fetch_ntia(grammar x) {
-    return internal::launder_grammar_data(x)._ppr_id_allocs;
+bool taul::parser::limit_exceeded() const noexcept {
+    return _limit_exceeded;
+}
+
+void taul::parser::limit(const parse_limits& limits) {
+    _limits = limits;
+    _limited = limits.any();
+}
+
+const taul::parse_limits& taul::parser::limits() const noexcept {
+    return _limits;
+}
+
+void taul::parser::omit(lpr_ref lpr) {
+    TAUL_ASSERT(gram.is_associated(lpr));
+    _omitted_lprs[lpr.index()] = true;
+}
+
+void taul::parser::omit(ppr_ref ppr) {
+    TAUL_ASSERT(gram.is_associated(ppr));
+    _omitted_pprs[ppr.index()] = true;
+}
+
+void taul::parser::clear_omissions() {
+    std::fill(_omitted_lprs.begin(), _omitted_lprs.end(), false);
+    std::fill(_omitted_pprs.begin(), _omitted_pprs.end(), false);
+}
+
+bool taul::parser::is_omitted(lpr_ref lpr) const noexcept {
+    TAUL_ASSERT(gram.is_associated(lpr));
+    return _omitted_lprs[lpr.index()];
+}
+
+bool taul::parser::is_omitted(ppr_ref ppr) const noexcept {
+    TAUL_ASSERT(gram.is_associated(ppr));
+    return _omitted_pprs[ppr.index()];
+}
+
+void taul::parser::defer(ppr_ref ppr, lpr_ref open, lpr_ref close) {
+    TAUL_ASSERT(gram.is_associated(ppr));
+    TAUL_ASSERT(gram.is_associated(open));
+    TAUL_ASSERT(gram.is_associated(close));
+    _deferrals[ppr.index()] = _deferral{ .open = open.id(), .close = close.id() };
+}
+
+void taul::parser::clear_deferrals() {
+    std::fill(_deferrals.begin(), _deferrals.end(), std::nullopt);
+}
+
+bool taul::parser::is_deferred(ppr_ref ppr) const noexcept {
+    TAUL_ASSERT(gram.is_associated(ppr));
+    return _deferrals[ppr.index()].has_value();
+}
+
+taul::parse_tree taul::parser::expand(const parse_tree& tree, const parse_tree::node& nd, const str& src) {
+    TAUL_ASSERT(!_result);
+    TAUL_ASSERT(tree.is_sealed());
+    TAUL_ASSERT(nd.is_deferred());
+    // parse the placeholder's portion of src, w/ positions of the new subtree
+    // being relative to the start of said portion, w/ our upstream and listener
+    // being swapped out for the duration of the parse
+    source_reader input(src.substr(nd.pos(), nd.len()));
+    lexer lxr(gram, lgr);
+    lxr.bind_source(&input);
+    token_stream* const source = _source;
+    token_queue* const push_source = _push_source;
+    listener* const lstnr = _listener;
+    _source = &lxr;
+    _push_source = nullptr;
+    _listener = nullptr;
+    _expanding = true;
+    reset();
+    const auto expansion = _parse(nd.ppr().value());
+    _expanding = false;
+    _source = source;
+    _push_source = push_source;
+    _listener = lstnr;
+    _valid = false;
+    return tree.graft(nd, expansion);
+}
+
+taul::reparse_result taul::parser::reparse(const parse_tree& old, source_pos pos, source_len old_len, source_len new_len) {
+    TAUL_ASSERT(old.is_sealed());
+    TAUL_ASSERT(old.root().is_syntactic());
+    TAUL_ASSERT(!_result);
+    _setup_reparse(old, pos, old_len, new_len);
+    _result = parse_tree(gram);
+    _omitted_stack.clear();
+    _perform_parse(old.root().ppr().value());
+    reparse_result result{
+        .tree = std::move(_result.value()),
+        .changed = {},
+    };
+    _result.reset();
+    // changed nodes are those not in any of the reused ranges
+    auto it = _reparse->reused.begin();
+    for (size_t i = 0; i < result.tree.nodes(); i++) {
+        if (it != _reparse->reused.end() && i == it->first) {
+            i = it->second - 1;
+            it++;
+            continue;
+        }
+        result.changed.push_back(i);
+    }
+    _reparse.reset();
+    return result;
+}
+
+taul::parse_tree taul::parser::splice(ppr_ref start_rule, std::span<const parse_tree> subtrees) {
+    return _perform_splice(start_rule, subtrees);
+}
+
+taul::parse_tree taul::parser::splice(const str& name, std::span<const parse_tree> subtrees) {
+    TAUL_ASSERT(gram.has_ppr(name));
+    return _perform_splice(gram.ppr(name).value(), subtrees);
+}
+
+taul::parser::checkpoint_t taul::parser::checkpoint() const {
+    TAUL_ASSERT(!_reparse);
+    TAUL_ASSERT(!_splice);
+    checkpoint_t result{};
+    result._ps = _ps.take_snapshot();
+    result._result = _result;
+    result._omitted_stack = _omitted_stack;
+    result._aborted = _aborted;
+    return result;
+}
+
+void taul::parser::restore(const checkpoint_t& cp) {
+    _ps.restore_snapshot(cp._ps);
+    _result = cp._result;
+    _omitted_stack = cp._omitted_stack;
+    _aborted = cp._aborted;
+}
+
+taul::parse_tree taul::parser::resume() {
+    TAUL_ASSERT(_result);
+    TAUL_ASSERT(!_push_source);
+    _perform_resume();
+    const auto result = std::move(_result.value());
+    _result.reset();
+    return result;
+}
+
+void taul::parser::resume_notree() {
+    TAUL_ASSERT(!_result);
+    _perform_resume();
+}
+
+void taul::parser::bind_push_source(token_queue* source) {
+    _source = source;
+    _source_ownership = nullptr;
+    _push_source = source;
+    _valid = false;
+}
+
+void taul::parser::bind_push_source(std::shared_ptr<token_queue> source) {
+    _source = source.get();
+    _source_ownership = source;
+    _push_source = source.get();
+    _valid = false;
 }
 
-const taul::internal::parse_table<taul::token>& taul::parser::_policy::fetch_pt(grammar x) {
-    return internal::launder_grammar_data(x)._ppr_pt;
+bool taul::parser::suspended() const noexcept {
+    return _ps.suspended();
+}
+
+const taul::internal::nonterminal_id_allocs<taul::token>& taul::parser::_policy::fetch_ntia(const internal::grammar_data& x) {
+    return x._ppr_id_allocs;
+}
+
+const taul::internal::parse_table<taul::token>& taul::parser::_policy::fetch_pt(const internal::grammar_data& x) {
+    return x._ppr_pt;
 }
 
 taul::token taul::parser::_policy::peek() {
@@ -121,6 +317,20 @@ taul::token taul::parser::_policy::next() {
         : token::end();
 }
 
+bool taul::parser::_policy::input_ready() {
+    return
+        _get_self()._push_source
+        ? _get_self()._push_source->ready()
+        : true;
+}
+
+bool taul::parser::_policy::input_complete() {
+    return
+        _get_self()._push_source
+        ? _get_self()._push_source->finished()
+        : true;
+}
+
 void taul::parser::_policy::reinit_output(rule_ref_type start_rule) {
     // do nothing
 }
@@ -134,6 +344,9 @@ std::string taul::parser::_policy::fmt_output() const {
 
 void taul::parser::_policy::output_startup() {
     _get_self()._aborted = false;
+    _get_self()._limit_exceeded = false;
+    _get_self()._steps = 0;
+    _get_self()._recoveries = 0;
     if (_get_self()._listener) _get_self()._listener->on_startup();
 }
 
@@ -146,7 +359,13 @@ void taul::parser::_policy::output_shutdown() {
 }
 
 void taul::parser::_policy::output_terminal(symbol_type terminal) {
-    if (_get_self()._result) _get_self()._result->lexical(terminal);
+    if (_get_self()._result) {
+        // omitted nodes still need to have their source code range
+        // contribute to the len of their parent node
+        const bool omitted = terminal.lpr && _get_self()._omitted_lprs[terminal.lpr->index()];
+        if (omitted) _get_self()._result->extend(terminal.high_pos());
+        else _get_self()._result->lexical(terminal);
+    }
     if (_get_self()._listener) _get_self()._listener->on_lexical(terminal);
 }
 
@@ -154,15 +373,78 @@ void taul::parser::_policy::output_nonterminal_begin(symbol_id nonterminal) {
     size_t ppr_index = size_t(nonterminal) - size_t(symbol_traits<token>::first_nonterminal_id);
     ppr_ref ppr = _get_self().gram.ppr_at(ppr_index);
     source_pos pos = peek().pos;
-    if (_get_self()._result) _get_self()._result->syntactic(ppr, pos);
+    if (_get_self()._result) {
+        // the start rule's node (ie. the root) is never omitted
+        const bool omitted = !_get_self()._omitted_stack.empty() && _get_self()._omitted_pprs[ppr_index];
+        if (omitted) _get_self()._result->extend(pos);
+        else _get_self()._result->syntactic(ppr, pos);
+        _get_self()._omitted_stack.push_back(omitted);
+    }
     if (_get_self()._listener) _get_self()._listener->on_syntactic(ppr, pos);
 }
 
 void taul::parser::_policy::output_nonterminal_end() {
-    if (_get_self()._result) _get_self()._result->close();
+    if (_get_self()._result) {
+        TAUL_ASSERT(!_get_self()._omitted_stack.empty());
+        if (!_get_self()._omitted_stack.back()) _get_self()._result->close();
+        _get_self()._omitted_stack.pop_back();
+    }
     if (_get_self()._listener) _get_self()._listener->on_close();
 }
 
+bool taul::parser::_policy::try_reuse_nonterminal(symbol_id nonterminal, symbol_type input) {
+    if (_get_self()._splice && _get_self()._result) return _get_self()._try_splice(nonterminal, input);
+    if (!_get_self()._reparse || !_get_self()._result) return false;
+    const auto& rs = *_get_self()._reparse;
+    size_t ppr_index = size_t(nonterminal) - size_t(symbol_traits<token>::first_nonterminal_id);
+    // helper non-terminals will have indices past the end of the PPRs
+    if (ppr_index >= _get_self().gram.pprs()) return false;
+    // subtrees of precedence PPRs depend upon the precedence values of 
+    // their context, which the old tree doesn't record, so don't reuse
+    if (_get_self().gram.ppr_at(ppr_index).qualifier() == qualifier::precedence) return false;
+    // map input.pos to a position in the old tree, if it's outside the edit
+    source_pos offset{}; // maps new positions to old ones
+    if (input.pos < rs.edit_begin) offset = 0;
+    else if (input.pos > rs.new_edit_end) offset = rs.offset;
+    else return false;
+    const auto [begin, end] = rs.starts.equal_range(input.pos + offset);
+    for (auto it = begin; it != end; it++) {
+        const auto& nd = rs.old->at(it->second);
+        if (nd.id() == nonterminal) return _get_self()._reuse(nd, source_pos(0) - offset);
+    }
+    return false;
+}
+
+bool taul::parser::_policy::try_defer_nonterminal(symbol_id nonterminal, symbol_type input) {
+    size_t ppr_index = size_t(nonterminal) - size_t(symbol_traits<token>::first_nonterminal_id);
+    // helper non-terminals will have indices past the end of _deferrals
+    if (ppr_index >= _get_self()._deferrals.size()) return false;
+    const auto& deferral = _get_self()._deferrals[ppr_index];
+    if (!deferral || input.id != deferral->open) return false;
+    // the start rule of expand's parse is that of the placeholder being expanded
+    if (_get_self()._expanding && _get_self()._result->nodes() == 0) return false;
+    // skip tokens until the open token we started w/ is balanced
+    const source_pos pos = input.pos;
+    token last = next(); // consume open token
+    size_t nesting = 1;
+    while (nesting > 0) {
+        const token tkn = peek();
+        if (tkn.is_end()) break;
+        // check close first, so open and close may be the same LPR
+        if (tkn.id == deferral->close) nesting--;
+        else if (tkn.id == deferral->open) nesting++;
+        last = next();
+    }
+    ppr_ref ppr = _get_self().gram.ppr_at(ppr_index);
+    const source_len len = last.high_pos() - pos;
+    if (_get_self()._result) _get_self()._result->deferred(ppr, pos, len);
+    if (_get_self()._listener) {
+        _get_self()._listener->on_syntactic(ppr, pos);
+        _get_self()._listener->on_close();
+    }
+    return true;
+}
+
 void taul::parser::_policy::output_terminal_error(symbol_range<symbol_type> ids, symbol_type input) {
     if (_get_self()._listener) _get_self()._listener->on_terminal_error(ids, input);
 }
@@ -180,10 +462,12 @@ void taul::parser::_policy::eh_shutdown() {
 }
 
 void taul::parser::_policy::eh_terminal_error(symbol_range<symbol_type> ids, symbol_type input) {
+    if (!_get_self()._within_recovery_limit()) return;
     if (_get_self()._eh) _get_self()._eh->terminal_error(ids, input);
 }
 
 void taul::parser::_policy::eh_nonterminal_error(symbol_id id, symbol_type input) {
+    if (!_get_self()._within_recovery_limit()) return;
     if (_get_self()._eh) _get_self()._eh->nonterminal_error(id, input);
 }
 
@@ -203,15 +487,181 @@ void taul::parser::_perform_parse(ppr_ref start_rule) {
 
 taul::parse_tree taul::parser::_parse(ppr_ref start_rule) {
     TAUL_ASSERT(!_result);
+    TAUL_ASSERT(!_push_source);
+    _result = parse_tree(gram);
+    _omitted_stack.clear();
+    _perform_parse(start_rule);
+    const auto result = std::move(_result.value());
+    _result.reset();
+    return result;
+}
+
+void taul::parser::_parse_into(ppr_ref start_rule, parse_tree& tree) {
+    TAUL_ASSERT(!_result);
+    TAUL_ASSERT(!_push_source);
+    // move tree in and out of _result, so its memory is reused
+    _result = std::move(tree);
+    _result->clear();
+    _omitted_stack.clear();
+    _perform_parse(start_rule);
+    tree = std::move(_result.value());
+    _result.reset();
+}
+
+void taul::parser::_perform_resume() {
+    TAUL_ASSERT(_valid);
+    _ps.resume();
+}
+
+void taul::parser::_setup_reparse(const parse_tree& old, source_pos pos, source_len old_len, source_len new_len) {
+    const size_t n = old.nodes();
+    _reparse_state rs{};
+    rs.old = &old;
+    rs.edit_begin = pos;
+    rs.edit_end = pos + old_len;
+    rs.new_edit_end = pos + new_len;
+    rs.offset = source_pos(old_len) - source_pos(new_len); // <- wraparound intended
+    rs.reusable.resize(n, false);
+    rs.ends.resize(n, 0);
+    rs.next_lexical.resize(n + 1, n);
+    // dirty tracks the number of failure/end tokens at/after each index
+    std::vector<size_t> dirty(n + 1, 0);
+    for (size_t i = n; i-- > 0;) {
+        const auto& nd = old.at(i);
+        rs.next_lexical[i] = nd.is_lexical() ? i : rs.next_lexical[i + 1];
+        dirty[i] = dirty[i + 1] + size_t(nd.is_lexical() && !nd.is_normal());
+        // right children have indices greater than their parents, so they'll
+        // have been visited already
+        rs.ends[i] = nd.has_children() ? rs.ends[nd.right_child()->index()] : i + 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        const auto& nd = old.at(i);
+        if (!nd.is_syntactic()) continue;
+        if (dirty[i] != dirty[rs.ends[i]]) continue;
+        // if the subtree lies before the edit, then so too must the token
+        // following it, which acted as its final lookahead, w/ us being
+        // conservative and requiring a gap between it and the edit
+        const size_t follow = rs.next_lexical[rs.ends[i]];
+        const bool before = follow < n && old.at(follow).high_pos() < rs.edit_begin;
+        const bool after = nd.low_pos() > rs.edit_end;
+        if (!before && !after) continue;
+        rs.reusable[i] = true;
+        rs.starts.emplace(nd.pos(), i);
+    }
+    // if old was aborted, the nodes which were still open upon abort are
+    // incomplete, and these are the ancestors of the final node
+    if (old.is_aborted() && n > 0) {
+        for (auto it = std::prev(old.end()); it != old.end(); it = it->parent()) {
+            rs.reusable[it->index()] = false;
+        }
+    }
+    _reparse = std::move(rs);
+}
+
+bool taul::parser::_reuse(const parse_tree::node& nd, source_pos offset) {
+    TAUL_ASSERT(_reparse);
+    TAUL_ASSERT(_result);
+    auto& rs = *_reparse;
+    const size_t index = nd.index();
+    if (!rs.reusable[index]) return false;
+    // as a sanity check, the subtree's first token (if any) should be our input
+    const size_t first_lexical = rs.next_lexical[index];
+    if (first_lexical < rs.ends[index]) {
+        const auto expected = rs.old->at(first_lexical).tkn().value();
+        const auto input = _source ? _source->peek() : token::end();
+        if (input.id != expected.id || input.pos != expected.pos + offset || input.len != expected.len) return false;
+    }
+    // skip past the tokens of the subtree, prior to any output
+    const source_pos high_pos = nd.high_pos() + offset;
+    while (_source && !_source->peek().is_end() && _source->peek().pos < high_pos) _source->next();
+    const size_t first_new = _result->nodes();
+    _result->graft(nd, offset);
+    rs.reused.push_back({ first_new, _result->nodes() });
+    if (_listener) _replay(*rs.old, index, rs.ends[index], offset);
+    return true;
+}
+
+taul::parse_tree taul::parser::_perform_splice(ppr_ref start_rule, std::span<const parse_tree> subtrees) {
+    TAUL_ASSERT(!_result);
+    TAUL_ASSERT(!_push_source);
+    _splice = _splice_state{ .subtrees = subtrees };
     _result = parse_tree(gram);
+    _omitted_stack.clear();
     _perform_parse(start_rule);
     const auto result = std::move(_result.value());
     _result.reset();
+    _splice.reset();
     return result;
 }
 
+bool taul::parser::_try_splice(symbol_id nonterminal, token input) {
+    TAUL_ASSERT(_splice);
+    TAUL_ASSERT(_result);
+    auto& ss = *_splice;
+    // input only ever advances, so subtrees behind it may be skipped for good
+    while (ss.next < ss.subtrees.size() && ss.subtrees[ss.next].root().pos() < input.pos) ss.next++;
+    if (ss.next == ss.subtrees.size()) return false;
+    const auto& tree = ss.subtrees[ss.next];
+    const auto& root = tree.root();
+    if (root.pos() != input.pos || root.id() != nonterminal) return false;
+    // as a sanity check, the subtree's first token (if any) should be our input
+    for (const auto& nd : tree) {
+        if (!nd.is_lexical()) continue;
+        const auto expected = nd.tkn().value();
+        if (input.id != expected.id || input.len != expected.len) return false;
+        break;
+    }
+    // skip past the tokens of the subtree, prior to any output
+    while (_source && !_source->peek().is_end() && _source->peek().pos < root.high_pos()) _source->next();
+    _result->graft(root);
+    if (_listener) _replay(tree, 0, tree.nodes(), 0);
+    ss.next++;
+    return true;
+}
+
+void taul::parser::_replay(const parse_tree& tree, size_t begin, size_t end, source_pos offset) {
+    TAUL_ASSERT(_listener);
+    std::vector<size_t> stk{};
+    for (size_t i = begin; i < end; i++) {
+        const auto& I = tree.at(i);
+        while (!stk.empty() && I.level() <= tree.at(stk.back()).level()) {
+            _listener->on_close();
+            stk.pop_back();
+        }
+        if (I.is_lexical()) {
+            auto tkn = I.tkn().value();
+            tkn.pos += offset;
+            _listener->on_lexical(tkn);
+        }
+        else {
+            _listener->on_syntactic(I.ppr().value(), I.pos() + offset);
+            if (I.is_deferred()) _listener->on_close();
+            else stk.push_back(i);
+        }
+    }
+    for (; !stk.empty(); stk.pop_back()) _listener->on_close();
+}
+
 void taul::parser::_parse_notree(ppr_ref start_rule) {
     TAUL_ASSERT(!_result);
     _perform_parse(start_rule);
 }
 
+bool taul::parser::_within_limits(size_t depth) {
+    const bool exceeded =
+        depth > _limits.max_depth ||
+        ++_steps > _limits.max_steps ||
+        (_result && _result->nodes() > _limits.max_nodes) ||
+        (_source && _source->limit_exceeded());
+    if (exceeded) {
+        _limit_exceeded = true;
+        _aborted = true;
+    }
+    return !exceeded;
+}
+
+bool taul::parser::_within_recovery_limit() {
+    if (!_limited || _recoveries++ < _limits.max_recoveries) return true;
+    _limit_exceeded = true;
+    return false; // failing recovery will abort
+}
@@ -3,8 +3,13 @@
 #pragma once
 
 
+#include <span>
+#include <unordered_map>
+
 #include "base_parser.h"
 #include "error_handler.h"
+#include "token_queue.h"
+#include "parse_limits.h"
 
 #include "internal/parse_table.h"
 #include "internal/parsing_system.h"
@@ -13,6 +18,14 @@
 namespace taul {
 
 
+    // reparse_result is the result of incremental reparsing
+
+    struct reparse_result final {
+        parse_tree tree; // the new parse tree
+        std::vector<size_t> changed; // indices of nodes of tree which were not reused, in ascending order
+    };
+
+
     class parser final : public base_parser {
     public:
 
@@ -31,11 +44,266 @@ namespace taul {
         parse_tree parse(const str& name) override final;
         void parse_notree(ppr_ref start_rule) override final;
         void parse_notree(const str& name) override final;
+
+        // parse_into is like parse, except that it outputs to tree, clearing
+        // it and reusing its memory, rather than creating a new parse tree
+
+        // behaviour is undefined if tree's grammar is not the parser's
+
+        void parse_into(ppr_ref start_rule, parse_tree& tree);
+        void parse_into(const str& name, parse_tree& tree);
         token eh_peek() override final;
         token eh_next() override final;
         bool eh_done() override final;
         bool eh_check() override final;
+        bool eh_recover() override final;
         void reset() override final;
+        bool limit_exceeded() const noexcept override final;
+
+
+        // omit specifies that the parser is to omit nodes of lpr from the
+        // parse trees it produces, w/ the source code ranges of omitted 
+        // nodes still contributing to the len of their parent nodes
+
+        // this is useful for things like punctuation, which take up space
+        // in the parse tree, but which go uninspected by end-user code
+
+        // omission does not effect listener events
+
+        // behaviour is undefined if lpr is not part of the parser's grammar
+
+        void omit(lpr_ref lpr);
+
+        // this overload specifies that the parser is to omit nodes of ppr,
+        // w/ the child nodes of omitted nodes becoming children of their
+        // parent node instead, as though ppr were transparent
+
+        // nodes of the start rule of a parse are never omitted
+
+        // behaviour is undefined if ppr is not part of the parser's grammar
+
+        void omit(ppr_ref ppr);
+
+        // clear_omissions undoes all prior omit calls
+
+        void clear_omissions();
+
+        // is_omitted returns if the parser omits nodes of lpr/ppr
+
+        bool is_omitted(lpr_ref lpr) const noexcept;
+        bool is_omitted(ppr_ref ppr) const noexcept;
+
+
+        // defer specifies that the parser is to *defer* parsing of ppr, w/
+        // the parser, upon beginning ppr w/ an open token as input, skipping
+        // over the tokens up to (and including) the close token balancing it,
+        // rather than parsing them
+
+        // deferred parsing results in a *placeholder* node being output
+        // in place of the subtree, which holds the source code range of
+        // the skipped tokens, and which may be later parsed via expand
+
+        // placeholder nodes are reported to the listener as syntactic
+        // nodes w/out any child nodes
+
+        // open and close may be the same LPR
+
+        // if input ends before the open token is balanced, the placeholder
+        // will span up to the end of the input
+
+        // behaviour is undefined if ppr, open or close are not part of the
+        // parser's grammar
+
+        void defer(ppr_ref ppr, lpr_ref open, lpr_ref close);
+
+        // clear_deferrals undoes all prior defer calls
+
+        void clear_deferrals();
+
+        // is_deferred returns if the parser defers parsing of ppr
+
+        bool is_deferred(ppr_ref ppr) const noexcept;
+
+        // expand returns a copy of tree, w/ the placeholder node nd replaced
+        // by the subtree resulting from parsing nd's portion of src, using 
+        // nd's PPR as the start rule
+
+        // the subtree is parsed w/ the parser's configuration (ie. omissions,
+        // deferrals, limits and error handler), so the subtree is that which
+        // would've been produced had nd's PPR not been deferred, w/ the 
+        // exception of deferred nodes nested within it
+
+        // the subtree's tokens are lexed by a lexer of the parser's own, in 
+        // place of its upstream token stream, w/ the parser's listener not
+        // receiving events for the subtree
+
+        // if parsing the subtree aborts, the tree returned will be marked
+        // as aborted
+
+        // expand invalidates the current pipeline usage state
+
+        // behaviour is undefined if tree's grammar is not the parser's
+
+        // behaviour is undefined if tree is not sealed, or if nd is not a 
+        // placeholder node of tree
+
+        // behaviour is undefined if src is not the correct source string to use
+
+        // behaviour is undefined if this is called during parsing
+
+        parse_tree expand(const parse_tree& tree, const parse_tree::node& nd, const str& src);
+
+
+        // reparse performs *incremental* reparsing, producing a new parse
+        // tree, w/ old being the parse tree of the source code prior to an
+        // edit, which replaced old_len characters at pos w/ new_len ones,
+        // w/ the upstream token stream being for the source code after it
+
+        // the start rule used is that of the root node of old
+
+        // subtrees of old which lie entirely outside the region of source
+        // code damaged by the edit, and who's lookahead token also lies 
+        // outside it, are reused rather than reparsed, w/ the parser
+        // skipping past their tokens
+
+        // a subtree is reused only when the parser begins a non-terminal
+        // of its PPR at the corresponding position, after the parse table 
+        // has selected a rule for it w/ the same lookahead, making it so
+        // the same rule would have been selected to parse it again
+
+        // subtrees of precedence PPRs, subtrees containing failure or end 
+        // tokens, and subtrees left incomplete by old being aborted, are 
+        // never reused
+
+        // listener events arise as they would w/ regular parsing
+
+        // behaviour is undefined if old is not sealed, or if its root is 
+        // not a syntactic node
+
+        // behaviour is undefined if old was not produced from the source
+        // code prior to the edit, or if the edit is not correctly described
+
+        reparse_result reparse(const parse_tree& old, source_pos pos, source_len old_len, source_len new_len);
+
+
+        // splice is like parse, except that upon beginning a non-terminal
+        // of the PPR of the root of one of subtrees, at the position of 
+        // that root, the parser grafts a copy of the subtree, skipping past
+        // its tokens, rather than parsing them
+
+        // this is used to assemble a parse tree from subtrees which were
+        // parsed separately (ie. in parallel, see region_parser)
+
+        // listener events arise as they would w/ regular parsing
+
+        // behaviour is undefined if subtrees are not sorted by the position
+        // of their roots, or if any of them is not sealed, or has a root 
+        // which is not a syntactic node
+
+        // behaviour is undefined if any subtree differs from that which
+        // would be produced by parsing its root's PPR from its root's
+        // position w/ the parser's upstream token stream
+
+        // behaviour is undefined if any subtree contains nodes which 
+        // the parser omits, or if any subtree's PPR is deferred
+
+        parse_tree splice(ppr_ref start_rule, std::span<const parse_tree> subtrees);
+        parse_tree splice(const str& name, std::span<const parse_tree> subtrees);
+
+
+        // limit sets the resource limits the parser enforces, w/ the parser 
+        // aborting upon exceeding any of them
+
+        // max_depth, max_nodes, max_recoveries and max_steps are enforced
+        // by the parser itself, w/ max_nodes only applying when producing 
+        // a parse tree, and w/ error recovery attempts past max_recoveries
+        // failing w/out the error handler being invoked
+
+        // max_lookahead is enforced by the lexer (see lexer::limit), w/ the
+        // parser aborting if its upstream reports limit_exceeded, provided 
+        // any limits are set for the parser
+
+        // limit_exceeded returns if the last parse aborted due to exceeding
+        // a limit, w/ this including limits of the parser's upstream
+
+        // limits are checked once per iteration of the parser's main loop,
+        // w/ these checks being skipped entirely if no limits are set
+
+        void limit(const parse_limits& limits);
+
+        const parse_limits& limits() const noexcept;
+
+
+        class checkpoint_t;
+
+        // checkpoint captures the state of the parser, such that parsing
+        // may later resume from where the checkpoint was taken, via restore
+        // followed by resume/resume_notree
+
+        // this is useful for things like resuming parsing after a listener
+        // failure, or retrying only the tail end of a token stream
+
+        // checkpoint may be called outside of parsing, or from within the
+        // on_lexical, on_syntactic and on_close events of the parser's 
+        // listener, w/ the state captured being that of just after the event
+
+        // behaviour is undefined if checkpoint is called at any other point
+        // during parsing (ie. during error recovery), or during reparsing
+
+        // checkpoints do not include the state of the upstream token stream,
+        // w/ the end-user being responsible for capturing/restoring it 
+        // alongside the parser (see lexer::checkpoint)
+
+        // checkpoints taken during parse, rather than parse_notree, will
+        // include a copy of the parse tree in production
+
+        checkpoint_t checkpoint() const;
+
+        // restore restores the parser state captured by cp
+
+        // restore may be used to abandon a parse which was interrupted
+        // (ie. by an exception thrown by the listener)
+
+        void restore(const checkpoint_t& cp);
+
+        // resume/resume_notree continue parsing from the current parser 
+        // state, as restored by restore, w/out reporting on_startup to 
+        // the listener a second time
+
+        // resume is to be used for checkpoints taken during parse, and
+        // resume_notree for those taken during parse_notree
+
+        parse_tree resume();
+        void resume_notree();
+
+
+        // bind_push_source binds source as the parser's upstream, as w/
+        // bind_source, but w/ the parser operating in *push mode*
+
+        // in push mode, parse_notree/resume_notree return early, w/ the
+        // parser *suspending*, upon needing a token which has yet to be
+        // pushed to source, w/ parsing being continued via resume_notree
+        // after pushing more tokens
+
+        // in push mode, upon an error, the parser suspends until source
+        // has finished, w/ error recovery being deferred until then, so
+        // the error handler can query tokens freely
+
+        // listener events are reported incrementally, as parsing progresses
+
+        // behaviour is undefined if parse/resume (rather than parse_notree
+        // and resume_notree) are used in push mode
+
+        // behaviour is undefined if deferred parsing, or reparse, are used
+        // in push mode
+
+        void bind_push_source(token_queue* source);
+        void bind_push_source(std::shared_ptr<token_queue> source);
+
+        // suspended returns if the last parse_notree/resume_notree call 
+        // suspended, w/ parsing awaiting further tokens
+
+        bool suspended() const noexcept;
 
 
     private:
@@ -43,10 +311,12 @@ namespace taul {
         struct _policy final {
             using symbol_type = token;
             using rule_ref_type = ppr_ref;
-            static const internal::nonterminal_id_allocs<symbol_type>& fetch_ntia(grammar x);
-            static const internal::parse_table<symbol_type>& fetch_pt(grammar x);
+            static const internal::nonterminal_id_allocs<symbol_type>& fetch_ntia(const internal::grammar_data& x);
+            static const internal::parse_table<symbol_type>& fetch_pt(const internal::grammar_data& x);
             symbol_type peek();
             symbol_type next();
+            bool input_ready();
+            bool input_complete();
             void reinit_output(rule_ref_type start_rule);
             std::string fmt_output() const;
             void output_startup();
@@ -54,6 +324,8 @@ namespace taul {
             void output_terminal(symbol_type terminal);
             void output_nonterminal_begin(symbol_id nonterminal);
             void output_nonterminal_end();
+            bool try_reuse_nonterminal(symbol_id nonterminal, symbol_type input);
+            bool try_defer_nonterminal(symbol_id nonterminal, symbol_type input);
             void output_terminal_error(symbol_range<symbol_type> ids, symbol_type input);
             void output_nonterminal_error(symbol_id id, symbol_type input);
             static constexpr bool uses_eh() noexcept { return true; }
@@ -62,6 +334,7 @@ namespace taul {
             void eh_terminal_error(symbol_range<symbol_type> ids, symbol_type input);
             void eh_nonterminal_error(symbol_id id, symbol_type input);
             void eh_recovery_failed();
+            inline bool within_limits(size_t depth) { return !_self_ptr->_limited || _self_ptr->_within_limits(depth); }
 
 
             parser* _self_ptr = nullptr; // link to parser
@@ -74,6 +347,7 @@ namespace taul {
 
         token_stream* _source;
         std::shared_ptr<token_stream> _source_ownership;
+        token_queue* _push_source = nullptr; // _source, if in push mode
         listener* _listener;
         std::shared_ptr<listener> _listener_ownership;
         error_handler* _eh;
@@ -82,8 +356,49 @@ namespace taul {
 
         bool _aborted = false; // if an abort occurred
 
+        parse_limits _limits;
+        bool _limited = false; // if any of _limits are set
+        bool _limit_exceeded = false; // if the last parse aborted due to a limit
+        size_t _steps = 0, _recoveries = 0; // counts for the current parse
+
         std::optional<parse_tree> _result; // the parse tree in production, if any
 
+        std::vector<bool> _omitted_lprs, _omitted_pprs; // indexed by LPR/PPR index
+        std::vector<bool> _omitted_stack; // if each currently open nonterminal's node was omitted
+
+        struct _deferral final {
+            symbol_id open, close; // the LPR IDs of the delimiters
+        };
+
+        std::vector<std::optional<_deferral>> _deferrals; // indexed by PPR index
+        bool _expanding = false; // if the current parse is that of expand, w/ its start rule never being deferred
+
+
+        // these positions are all in terms of the source code prior to the edit,
+        // w/ offset being added (w/ wraparound) to map positions after the edit
+        // back to positions prior to it
+
+        struct _reparse_state final {
+            const parse_tree* old = nullptr;
+            source_pos edit_begin = 0, edit_end = 0; // the edited range, before the edit
+            source_pos new_edit_end = 0; // the end of the edited range, after the edit
+            source_pos offset = 0; // the offset to add to positions after the edit, mapping them to old ones
+            std::unordered_multimap<source_pos, size_t> starts; // maps positions to nodes starting at them
+            std::vector<bool> reusable; // if each node's subtree may be reused
+            std::vector<size_t> ends; // the index past the end of each node's subtree
+            std::vector<size_t> next_lexical; // index of the first lexical node at/after each index
+            std::vector<std::pair<size_t, size_t>> reused; // index ranges of reused nodes in new tree
+        };
+
+        std::optional<_reparse_state> _reparse; // reparse state, if reparsing
+
+        struct _splice_state final {
+            std::span<const parse_tree> subtrees;
+            size_t next = 0; // the index of the first subtree not behind input
+        };
+
+        std::optional<_splice_state> _splice; // splice state, if splicing
+
         internal::parsing_system<_policy> _ps; // the parsing system backend
 
 
@@ -94,6 +409,37 @@ namespace taul {
 
         parse_tree _parse(ppr_ref start_rule);
         void _parse_notree(ppr_ref start_rule);
+        void _parse_into(ppr_ref start_rule, parse_tree& tree);
+
+        void _perform_resume();
+
+        void _setup_reparse(const parse_tree& old, source_pos pos, source_len old_len, source_len new_len);
+        bool _reuse(const parse_tree::node& nd, source_pos offset); // offset maps old positions to new ones
+
+        parse_tree _perform_splice(ppr_ref start_rule, std::span<const parse_tree> subtrees);
+        bool _try_splice(symbol_id nonterminal, token input);
+
+        // _replay reports the nodes of tree in [begin, end) to the listener,
+        // w/ end being the index past the end of the subtree rooted at begin
+
+        void _replay(const parse_tree& tree, size_t begin, size_t end, source_pos offset);
+
+        bool _within_limits(size_t depth);
+        bool _within_recovery_limit();
+    };
+
+    class parser::checkpoint_t final {
+    public:
+
+        friend class parser;
+
+
+    private:
+
+        internal::parsing_system<parser::_policy>::snapshot _ps;
+        std::optional<parse_tree> _result;
+        std::vector<bool> _omitted_stack;
+        bool _aborted = false;
     };
 }
 
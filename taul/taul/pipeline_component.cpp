@@ -6,3 +6,6 @@
 taul::pipeline_component::pipeline_component(std::shared_ptr<logger> lgr) 
     : api_component(lgr) {}
 
+bool taul::pipeline_component::limit_exceeded() const noexcept {
+    return false;
+}
@@ -48,6 +48,14 @@ namespace taul {
         // is invalidated until the pipeline is reset
 
         virtual void reset() = 0;
+
+
+        // limit_exceeded returns if the component cut its output short, 
+        // since its last reset, due to exceeding a resource limit (see
+        // parse_limits), w/ downstream components using this to tell 
+        // truncated input from genuine end-of-input
+
+        virtual bool limit_exceeded() const noexcept;
     };
 }
 
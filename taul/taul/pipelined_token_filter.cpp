@@ -0,0 +1,128 @@
+
+
+#include "pipelined_token_filter.h"
+
+
+taul::pipelined_token_filter::pipelined_token_filter(size_t capacity, std::shared_ptr<logger> lgr)
+    : token_filter(lgr),
+    _source(nullptr),
+    _observer(nullptr),
+    _ring(capacity) {}
+
+taul::pipelined_token_filter::~pipelined_token_filter() noexcept {
+    _stop_producer();
+}
+
+void taul::pipelined_token_filter::bind_source(token_stream* source) {
+    _stop_producer();
+    _source = source;
+    _source_ownership = nullptr;
+    _valid = false;
+}
+
+void taul::pipelined_token_filter::bind_source(std::shared_ptr<token_stream> source) {
+    _stop_producer();
+    _source = source.get();
+    _source_ownership = source;
+    _valid = false;
+}
+
+taul::token_stream* taul::pipelined_token_filter::source() const noexcept {
+    return _source;
+}
+
+void taul::pipelined_token_filter::bind_observer(token_observer* observer) {
+    _observer = observer;
+    _observer_ownership = nullptr;
+}
+
+void taul::pipelined_token_filter::bind_observer(std::shared_ptr<token_observer> observer) {
+    _observer = observer.get();
+    _observer_ownership = observer;
+}
+
+taul::token taul::pipelined_token_filter::peek() {
+    return _peek();
+}
+
+taul::token taul::pipelined_token_filter::next() {
+    token result = _peek();
+    if (_observer) _observer->observe(result);
+    // end-of-input tokens are cached in _end, rather than being left in _ring
+    if (!result.is_end()) _ring.pop();
+    return result;
+}
+
+bool taul::pipelined_token_filter::done() {
+    return _peek().is_end();
+}
+
+void taul::pipelined_token_filter::reset() {
+    _stop_producer();
+    _ring.clear();
+    _end.reset();
+    _source_limit_exceeded = false;
+    if (_source) _source->reset();
+    _valid = true;
+}
+
+bool taul::pipelined_token_filter::limit_exceeded() const noexcept {
+    // the end-of-input token being popped means the producer's write to
+    // _source_limit_exceeded is visible to us
+    return _end && _source_limit_exceeded;
+}
+
+void taul::pipelined_token_filter::_start_producer() {
+    TAUL_ASSERT(!_producer.joinable());
+    _stop.store(false);
+    _exited.store(false);
+    _producer = std::thread([this] { _produce(); });
+}
+
+void taul::pipelined_token_filter::_stop_producer() {
+    if (!_producer.joinable()) return;
+    _stop.store(true);
+    // keep popping published tokens until the producer exits, so if it's blocked
+    // on a full ring (incl. one it only publishes upon blocking) it'll wake up and
+    // see _stop
+    while (!_exited.load()) {
+        if (_ring.front()) _ring.pop();
+        else std::this_thread::yield();
+    }
+    _producer.join();
+}
+
+void taul::pipelined_token_filter::_produce() {
+    TAUL_ASSERT(_source);
+    // publish before the ring fills w/ unpublished tokens, so small capacity
+    // rings don't leave the consumer waiting on tokens we've already got
+    const size_t threshold = std::min(_batch_size, std::max(_ring.capacity() / 2, size_t(1)));
+    while (!_stop.load(std::memory_order_relaxed)) {
+        const token tkn = _source->next();
+        if (tkn.is_end()) _source_limit_exceeded = _source->limit_exceeded();
+        while (!_ring.try_push(tkn)) {
+            _ring.wait_for_space();
+            if (_stop.load(std::memory_order_relaxed)) break;
+        }
+        if (tkn.is_end()) break;
+        if (_ring.pending() >= threshold) _ring.publish();
+    }
+    _ring.publish();
+    _exited.store(true);
+}
+
+taul::token taul::pipelined_token_filter::_peek() {
+    TAUL_ASSERT(_valid);
+    if (_end) return _end.value();
+    // w/out a source, the filter ends up-front
+    if (!_source) return token::end();
+    if (!_producer.joinable()) _start_producer();
+    _ring.wait_for_data();
+    const token result = *_ring.front();
+    if (result.is_end()) {
+        _end = result;
+        _ring.pop();
+    }
+    return result;
+}
+
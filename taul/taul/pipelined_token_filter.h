@@ -0,0 +1,99 @@
+
+
+#pragma once
+
+
+#include <thread>
+
+#include "symbol_filter.h"
+
+#include "internal/spsc_ring.h"
+
+
+namespace taul {
+
+
+    // pipelined_token_filter is a token filter which pulls tokens from its
+    // upstream source on a background *producer* thread, passing them to
+    // the thread using the filter (ie. a parser) via a bounded lock-free
+    // ring buffer, so lexing and parsing may be performed concurrently
+
+    // the filter doesn't change the tokens passing through it, w/ the
+    // parser (and its error handler, via eh_peek/eh_next) seeing the 
+    // same stream as it would w/out it
+
+    // the producer thread is started upon the first peek/next/done call
+    // following a reset, and is stopped upon reset, bind_source, or the
+    // filter's destruction, or after it pulls an end-of-input token
+
+    // while the producer thread is running, the upstream source (and any 
+    // observers bound to it) are used exclusively by it, w/ behaviour being
+    // undefined if they're used by any other thread during this time
+
+    // observers bound to the filter itself are invoked on the thread using
+    // the filter, as usual
+
+    // behaviour is undefined if the upstream source throws
+
+
+    class pipelined_token_filter final : public token_filter {
+    public:
+
+        static constexpr size_t default_capacity = 1024;
+
+
+        pipelined_token_filter(size_t capacity = default_capacity, std::shared_ptr<logger> lgr = nullptr);
+
+        virtual ~pipelined_token_filter() noexcept;
+
+
+        void bind_source(token_stream* source) override final;
+        void bind_source(std::shared_ptr<token_stream> source) override final;
+        token_stream* source() const noexcept override final;
+        void bind_observer(token_observer* observer) override final;
+        void bind_observer(std::shared_ptr<token_observer> observer) override final;
+        token peek() override final;
+        token next() override final;
+        bool done() override final;
+        void reset() override final;
+
+        // the upstream source is used by the producer thread, so rather than
+        // forwarding its limit_exceeded directly, the producer records it upon
+        // pulling the end-of-input token, w/ this returning it once that token
+        // has reached the consumer
+
+        bool limit_exceeded() const noexcept override final;
+
+
+    private:
+
+        bool _valid = true;
+
+        token_stream* _source;
+        std::shared_ptr<token_stream> _source_ownership;
+        token_observer* _observer;
+        std::shared_ptr<token_observer> _observer_ownership;
+
+        internal::spsc_ring<token> _ring;
+        std::thread _producer;
+        std::atomic<bool> _stop = false;
+        std::atomic<bool> _exited = false; // set by the producer upon exiting
+        std::optional<token> _end; // the end-of-input token, once popped
+        bool _source_limit_exceeded = false; // written by the producer prior to publishing the end-of-input token
+
+        // the producer publishes tokens in batches of this size, unless
+        // it's blocked, or has reached end-of-input
+
+        static constexpr size_t _batch_size = 32;
+
+
+        void _start_producer();
+        void _stop_producer();
+        void _produce();
+
+        // these help avoid virtual call indirection
+
+        token _peek();
+    };
+}
+
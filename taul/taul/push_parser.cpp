@@ -0,0 +1,112 @@
+
+
+#include "push_parser.h"
+
+
+taul::push_parser::push_parser(grammar gram, encoding in_e, std::shared_ptr<logger> lgr)
+    : api_component(lgr),
+    _reader(in_e),
+    _lexer(gram, lgr),
+    _queue(lgr),
+    _parser(gram, lgr) {
+    _lexer.bind_source(&_reader);
+    _parser.bind_push_source(&_queue);
+}
+
+void taul::push_parser::bind_listener(listener* listener) {
+    _parser.bind_listener(listener);
+}
+
+void taul::push_parser::bind_listener(std::shared_ptr<listener> listener) {
+    _parser.bind_listener(listener);
+}
+
+void taul::push_parser::bind_error_handler(error_handler* error_handler) {
+    _parser.bind_error_handler(error_handler);
+}
+
+void taul::push_parser::bind_error_handler(std::shared_ptr<error_handler> error_handler) {
+    _parser.bind_error_handler(error_handler);
+}
+
+taul::lexer& taul::push_parser::get_lexer() noexcept {
+    return _lexer;
+}
+
+taul::parser& taul::push_parser::get_parser() noexcept {
+    return _parser;
+}
+
+void taul::push_parser::start(ppr_ref start_rule) {
+    TAUL_ASSERT(_parser.gram.is_associated(start_rule));
+    _reader.clear();
+    _queue.clear();
+    _lexer.reset();
+    _parser.reset(); // <- resets _queue, but not _reader, as _lexer isn't upstream of _parser
+    _start_rule = start_rule;
+    _running = true;
+}
+
+void taul::push_parser::start(const str& name) {
+    TAUL_ASSERT(_parser.gram.has_ppr(name));
+    start(_parser.gram.ppr(name).value());
+}
+
+void taul::push_parser::feed(std::span<const char> chunk) {
+    TAUL_ASSERT(_running);
+    _reader.feed(chunk);
+    _advance();
+}
+
+void taul::push_parser::finish() {
+    TAUL_ASSERT(_running);
+    _reader.finish();
+    _advance();
+    TAUL_ASSERT(!_parser.suspended());
+    _running = false;
+}
+
+bool taul::push_parser::running() const noexcept {
+    return _running;
+}
+
+size_t taul::push_parser::buffered_chars() const noexcept {
+    return _reader.buffered();
+}
+
+size_t taul::push_parser::buffered_tokens() const noexcept {
+    return _queue.buffered();
+}
+
+void taul::push_parser::_lex() {
+    while (!_queue.finished()) {
+        // lex the next token, and if the reader starved while doing so, then the
+        // token may be incomplete, so rollback, and wait for more input
+        const auto reader_cp = _reader.checkpoint();
+        const auto lexer_cp = _lexer.checkpoint();
+        _reader.unstarve();
+        const token tkn = _lexer.next();
+        if (_reader.starved()) {
+            _reader.restore(reader_cp);
+            _lexer.restore(lexer_cp);
+            break;
+        }
+        _queue.push(tkn);
+    }
+    _reader.discard();
+}
+
+void taul::push_parser::_parse() {
+    if (_start_rule) {
+        _parser.parse_notree(_start_rule.value());
+        _start_rule.reset();
+    }
+    else if (_parser.suspended()) _parser.resume_notree();
+    _queue.discard();
+}
+
+void taul::push_parser::_advance() {
+    _lex();
+    _parse();
+}
+
@@ -0,0 +1,102 @@
+
+
+#pragma once
+
+
+#include "chunk_reader.h"
+#include "token_queue.h"
+#include "lexer.h"
+#include "parser.h"
+
+
+namespace taul {
+
+
+    // push_parser bundles a chunk_reader, lexer, token_queue and parser
+    // into a *push-based* pipeline, w/ the end-user pushing input to it 
+    // in chunks via feed, and then calling finish once all input has 
+    // arrived, w/ lexing and parsing advancing as far as the available
+    // input allows upon each call
+
+    // results are reported via listener events, which arise incrementally,
+    // w/ push_parser not producing parse trees
+
+    // glyphs and tokens are discarded once they're no longer needed, so
+    // memory usage remains bounded, regardless of input size (unless an
+    // error occurs, w/ error recovery being deferred until finish)
+
+    // tokens are only produced once the input of the token after them 
+    // has arrived (as the lexer lexes one token ahead), w/ tokens which
+    // end at the end of the input available not being produced until
+    // more input arrives (or finish is called), as they may yet be
+    // extended by it
+
+
+    class push_parser final : public api_component {
+    public:
+
+        push_parser(grammar gram, encoding in_e = utf8, std::shared_ptr<logger> lgr = nullptr);
+
+        virtual ~push_parser() noexcept = default;
+
+
+        // these bind the listener/error handler of the internal parser
+
+        void bind_listener(listener* listener);
+        void bind_listener(std::shared_ptr<listener> listener);
+        void bind_error_handler(error_handler* error_handler);
+        void bind_error_handler(std::shared_ptr<error_handler> error_handler);
+
+        // these provide access to the internal lexer/parser, for configuring 
+        // them (ie. lexer::cut_skip_tokens, parser::omit)
+
+        lexer& get_lexer() noexcept;
+        parser& get_parser() noexcept;
+
+
+        // start begins a new round of parsing, discarding all prior input
+
+        void start(ppr_ref start_rule);
+        void start(const str& name);
+
+        // feed pushes a new chunk of input, advancing lexing/parsing
+
+        // behaviour is undefined if called outside of a round of parsing
+
+        void feed(std::span<const char> chunk);
+
+        // finish specifies that all input has arrived, finishing the 
+        // round of parsing
+
+        // behaviour is undefined if called outside of a round of parsing
+
+        void finish();
+
+        // running returns if a round of parsing is underway
+
+        bool running() const noexcept;
+
+        // these return the number of chars/tokens currently held, which
+        // have yet to be discarded
+
+        size_t buffered_chars() const noexcept;
+        size_t buffered_tokens() const noexcept;
+
+
+    private:
+
+        chunk_reader _reader;
+        lexer _lexer;
+        token_queue _queue;
+        parser _parser;
+
+        std::optional<ppr_ref> _start_rule; // the start rule, if parsing is yet to begin
+        bool _running = false;
+
+
+        void _lex();
+        void _parse();
+        void _advance();
+    };
+}
+
@@ -0,0 +1,152 @@
+
+
+#include "region_parser.h"
+
+#include <atomic>
+#include <thread>
+
+
+taul::region_parser::region_parser(grammar gram, size_t workers, std::shared_ptr<logger> lgr)
+    : api_component(lgr),
+    gram(gram),
+    _final(gram, lgr),
+    _nesting(gram.lprs(), 0) {
+    if (workers == 0) workers = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    _workers.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        _workers.push_back(std::make_unique<parser>(gram, lgr));
+    }
+}
+
+size_t taul::region_parser::workers() const noexcept {
+    return _workers.size();
+}
+
+void taul::region_parser::bind_listener(listener* listener) {
+    _final.bind_listener(listener);
+}
+
+void taul::region_parser::bind_listener(std::shared_ptr<listener> listener) {
+    _final.bind_listener(listener);
+}
+
+void taul::region_parser::bind_error_handler(error_handler* error_handler) {
+    _final.bind_error_handler(error_handler);
+}
+
+void taul::region_parser::bind_error_handler(std::shared_ptr<error_handler> error_handler) {
+    _final.bind_error_handler(error_handler);
+}
+
+void taul::region_parser::bracket(lpr_ref open, lpr_ref close) {
+    TAUL_ASSERT(gram.is_associated(open));
+    TAUL_ASSERT(gram.is_associated(close));
+    _nesting[open.index()] = 1;
+    _nesting[close.index()] = -1;
+}
+
+void taul::region_parser::clear_brackets() {
+    std::fill(_nesting.begin(), _nesting.end(), 0);
+}
+
+size_t taul::region_parser::region_size() const noexcept {
+    return _region_size;
+}
+
+void taul::region_parser::region_size(size_t tokens) {
+    _region_size = std::max(tokens, size_t(1));
+}
+
+taul::parse_tree taul::region_parser::parse(const token_buffer& tokens, ppr_ref start_rule, ppr_ref item_rule) {
+    TAUL_ASSERT(gram.is_associated(start_rule));
+    TAUL_ASSERT(gram.is_associated(item_rule));
+    _regions = 0;
+    _subtrees = 0;
+    std::vector<parse_tree> subtrees{};
+    // subtrees of precedence PPRs depend upon the precedence values of their
+    // context, so can't be parsed w/out it
+    if (item_rule.qualifier() != qualifier::precedence && _workers.size() > 1 && tokens.size() >= _region_size * 2) {
+        const auto regions = _split(tokens, item_rule);
+        std::vector<std::vector<parse_tree>> results(regions.size());
+        // regions are handed out dynamically, so workers who get cheap
+        // regions don't end up idle
+        std::atomic<size_t> next = 0;
+        const auto work = [&](parser& psr) {
+            for (size_t i = next.fetch_add(1); i < regions.size(); i = next.fetch_add(1)) {
+                _parse_region(psr, tokens, item_rule, regions[i], results[i]);
+            }
+            };
+        std::vector<std::thread> threads{};
+        threads.reserve(_workers.size() - 1);
+        for (size_t i = 1; i < _workers.size(); i++) {
+            threads.emplace_back([&, i] { work(*_workers[i]); });
+        }
+        work(*_workers[0]); // <- the calling thread acts as the first worker
+        for (auto& t : threads) t.join();
+        for (auto& r : results) {
+            for (auto& tree : r) subtrees.push_back(std::move(tree));
+        }
+        _regions = regions.size();
+        _subtrees = subtrees.size();
+    }
+    _final.bind_source(tokens.make_cursor());
+    _final.reset();
+    return _final.splice(start_rule, subtrees);
+}
+
+taul::parse_tree taul::region_parser::parse(const token_buffer& tokens, const str& start_rule, const str& item_rule) {
+    TAUL_ASSERT(gram.has_ppr(start_rule));
+    TAUL_ASSERT(gram.has_ppr(item_rule));
+    return parse(tokens, gram.ppr(start_rule).value(), gram.ppr(item_rule).value());
+}
+
+size_t taul::region_parser::regions() const noexcept {
+    return _regions;
+}
+
+size_t taul::region_parser::subtrees() const noexcept {
+    return _subtrees;
+}
+
+std::vector<std::pair<size_t, size_t>> taul::region_parser::_split(const token_buffer& tokens, ppr_ref item_rule) const {
+    const auto& first = item_rule.first_set();
+    const auto tkns = tokens.tokens();
+    // aim for a few regions per worker, so they balance out
+    const size_t target = std::max(_region_size, tkns.size() / (_workers.size() * 4));
+    std::vector<size_t> boundaries{};
+    int depth = 0;
+    for (size_t i = 0; i < tkns.size(); i++) {
+        const token& tkn = tkns[i];
+        if (!tkn.is_normal()) continue;
+        const size_t lpr_index = size_t(tkn.id - first_lpr_id);
+        if (depth == 0 && first.includes_id(tkn.id)) {
+            if (boundaries.empty() || i - boundaries.back() >= target) boundaries.push_back(i);
+        }
+        depth = std::max(depth + _nesting[lpr_index], 0);
+    }
+    std::vector<std::pair<size_t, size_t>> result{};
+    for (size_t i = 0; i < boundaries.size(); i++) {
+        result.push_back({ boundaries[i], i + 1 < boundaries.size() ? boundaries[i + 1] : tkns.size() });
+    }
+    return result;
+}
+
+void taul::region_parser::_parse_region(parser& psr, const token_buffer& tokens, ppr_ref item_rule, std::pair<size_t, size_t> region, std::vector<parse_tree>& results) const {
+    const auto [begin, end] = region;
+    // the cursor isn't limited to the region, so the final item of the
+    // region sees the same lookahead as it would w/ single threaded parsing
+    const auto cursor = tokens.make_cursor();
+    psr.bind_source(cursor);
+    psr.reset();
+    cursor->seek(begin);
+    while (cursor->position() < end) {
+        const size_t before = cursor->position();
+        auto tree = psr.parse(item_rule);
+        // stop upon failure, or if the subtree needed tokens past the region
+        // (ie. the boundary wasn't actually between items), or if it consumed
+        // nothing (which would otherwise loop forever)
+        if (tree.is_aborted() || cursor->position() > end || cursor->position() == before) break;
+        results.push_back(std::move(tree));
+    }
+}
+
@@ -0,0 +1,138 @@
+
+
+#pragma once
+
+
+#include <memory>
+#include <vector>
+
+#include "parser.h"
+#include "token_buffer.h"
+
+
+namespace taul {
+
+
+    // region_parser parses large single documents in parallel, by splitting
+    // their tokens into *regions* at top-level boundaries, parsing the regions
+    // concurrently, and then assembling the final parse tree from the results
+
+    // boundaries are placed before tokens in the FIRST set of an *item rule*
+    // which appear at *nesting depth* 0, w/ nesting depth being tracked via
+    // the *bracket* LPRs specified by the end-user
+
+    // each region is parsed on a worker thread as a sequence of item rule
+    // subtrees, w/ the final parse tree then being produced by parsing the
+    // whole document via parser::splice, w/ these subtrees being grafted in
+    // rather than parsed again
+
+    // to ensure the final parse tree is exactly that which parsing on a single
+    // thread would produce, each region's final item sees the token following
+    // the region as its lookahead, w/ subtrees which fail to parse, or which 
+    // would need tokens beyond their region, being discarded, w/ the tokens
+    // of such subtrees simply being parsed regularly when assembling
+
+    // the final pass still visits every token, but skipping over the tokens
+    // of a grafted subtree is far cheaper than parsing them
+
+    // listener events, and error handling, arise as w/ regular parsing, w/
+    // them occurring on the thread calling parse, during the final pass
+
+    // behaviour is undefined if parse is called concurrently
+
+
+    class region_parser final : public api_component {
+    public:
+
+        // if workers == 0, std::thread::hardware_concurrency is used
+
+        region_parser(grammar gram, size_t workers = 0, std::shared_ptr<logger> lgr = nullptr);
+
+        region_parser(const region_parser&) = delete;
+        region_parser(region_parser&&) = delete;
+
+        virtual ~region_parser() noexcept = default;
+
+        region_parser& operator=(const region_parser&) = delete;
+        region_parser& operator=(region_parser&&) = delete;
+
+
+        const grammar gram;
+
+
+        // default_region_size is the default minimum number of tokens per region
+
+        static constexpr size_t default_region_size = 4096;
+
+
+        // workers returns the number of worker threads used
+
+        size_t workers() const noexcept;
+
+        // bind_listener/bind_error_handler bind the listener/error handler
+        // used by the final pass, if any
+
+        void bind_listener(listener* listener);
+        void bind_listener(std::shared_ptr<listener> listener);
+        void bind_error_handler(error_handler* error_handler);
+        void bind_error_handler(std::shared_ptr<error_handler> error_handler);
+
+
+        // bracket specifies that open and close delimit a level of nesting
+
+        // behaviour is undefined if open or close are not part of the grammar
+
+        void bracket(lpr_ref open, lpr_ref close);
+
+        // clear_brackets undoes all prior bracket calls
+
+        void clear_brackets();
+
+        // region_size returns/sets the minimum number of tokens per region
+
+        // documents w/ fewer tokens than this are parsed on a single thread
+
+        size_t region_size() const noexcept;
+        void region_size(size_t tokens);
+
+
+        // parse parses tokens w/ start_rule, w/ item_rule subtrees being 
+        // parsed in parallel, returning the parse tree
+
+        // behaviour is undefined if start_rule or item_rule are not part
+        // of the grammar
+
+        parse_tree parse(const token_buffer& tokens, ppr_ref start_rule, ppr_ref item_rule);
+        parse_tree parse(const token_buffer& tokens, const str& start_rule, const str& item_rule);
+
+
+        // regions returns the number of regions the last parse was split into
+
+        size_t regions() const noexcept;
+
+        // subtrees returns the number of item rule subtrees parsed in
+        // parallel by the last parse, all of which will have been grafted
+        // unless the final pass encountered errors
+
+        size_t subtrees() const noexcept;
+
+
+    private:
+
+        parser _final; // the parser used for the final pass
+
+        std::vector<std::unique_ptr<parser>> _workers;
+
+        std::vector<int> _nesting; // the nesting delta of each LPR, indexed by LPR index
+
+        size_t _region_size = default_region_size;
+
+        size_t _regions = 0, _subtrees = 0;
+
+
+        std::vector<std::pair<size_t, size_t>> _split(const token_buffer& tokens, ppr_ref item_rule) const;
+
+        void _parse_region(parser& psr, const token_buffer& tokens, ppr_ref item_rule, std::pair<size_t, size_t> region, std::vector<parse_tree>& results) const;
+    };
+}
+
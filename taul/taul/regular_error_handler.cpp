@@ -19,21 +19,13 @@ void taul::regular_error_handler::shutdown() {
 
 void taul::regular_error_handler::terminal_error(token_range ids, token input) {
     TAUL_DEREF_SAFE(_client) {
-        while (true) {
-            if (_client->eh_done()) return;
-            if (_client->eh_check()) return;
-            _client->eh_next();
-        }
+        _client->eh_recover();
     }
 }
 
 void taul::regular_error_handler::nonterminal_error(symbol_id id, token input) {
     TAUL_DEREF_SAFE(_client) {
-        while (true) {
-            if (_client->eh_done()) return;
-            if (_client->eh_check()) return;
-            _client->eh_next();
-        }
+        _client->eh_recover();
     }
 }
 
@@ -108,19 +108,27 @@ bool taul::source_code::add_file(
         std::string buff{};
         buff.resize(file_size, '\0');
         ifs.read(buff.data(), file_size);
-        
-        // gotta do this to *filter out* BOM if src_path file is actually UTF-8 BOM
-        if (check_bom(utf8, std::string_view(buff)) != bom_status::no_bom) {
-            buff = convert_encoding<char>(utf8_bom, utf8, buff).value();
-        }
-
-        add_str(taul::str(short_path.string()), taul::str(buff));
+        add_file_contents(src_path, taul::str(buff));
         TAUL_LOG(lgr, "loaded source code page ({} char) from \"{}\"!", ifs.gcount(), short_path_s);
     }
     TAUL_LOG_IF(!ifs.is_open(), lgr, "failed source code page load due to \"{}\" not found!", short_path_s);
     return ifs.is_open();
 }
 
+void taul::source_code::add_file_contents(
+    const std::filesystem::path& src_path,
+    taul::str x) {
+    // try make a short path string to use as origin
+    auto short_path = std::filesystem::proximate(src_path, std::filesystem::current_path());
+
+    // gotta do this to *filter out* BOM if src_path file is actually UTF-8 BOM
+    if (check_bom(utf8, std::string_view(x)) != bom_status::no_bom) {
+        x = taul::str(convert_encoding<char>(utf8_bom, utf8, std::string_view(x)).value());
+    }
+
+    add_str(taul::str(short_path.string()), std::move(x));
+}
+
 void taul::source_code::reset() noexcept {
     *this = std::move(source_code{});
 }
@@ -181,6 +181,14 @@ namespace taul {
             const std::filesystem::path& src_path,
             const std::shared_ptr<logger>& lgr = nullptr);
 
+        // add_file_contents adds x as a source code page as though add_file had
+        // imported it from the text file at src_path, for when x is the already
+        // read contents of that file
+
+        void add_file_contents(
+            const std::filesystem::path& src_path,
+            taul::str x);
+
 
         // reset resets the state of the source code object
 
@@ -56,6 +56,15 @@ void taul::source_reader::change_input(const source_code& new_input) {
     change_input(new_input.str());
 }
 
+taul::source_reader::checkpoint_t taul::source_reader::checkpoint() const noexcept {
+    return checkpoint_t(_decoder.pos());
+}
+
+void taul::source_reader::restore(checkpoint_t cp) {
+    _reset();
+    _decoder.skip(cp);
+}
+
 taul::glyph taul::source_reader::_peek() {
     auto data = _decoder.peek();
     if (_done()) return glyph::end(source_pos(_decoder.pos()));
@@ -36,6 +36,18 @@ namespace taul {
         void change_input(const source_code& new_input);
 
 
+        // checkpoint/restore are used to capture, and later restore, the
+        // read position of the reader
+
+        // behaviour is undefined if the input of the reader has changed
+        // between checkpoint and restore
+
+        using checkpoint_t = size_t;
+
+        checkpoint_t checkpoint() const noexcept;
+        void restore(checkpoint_t cp);
+
+
     private:
 
         str _input;
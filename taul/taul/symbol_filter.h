@@ -41,11 +41,30 @@ namespace taul {
         // this version takes ownership of the upstream stream
 
         virtual void bind_source(std::shared_ptr<symbol_stream<Symbol>> source) = 0;
+
+        // source returns the stream upstream to the filter, if any
+
+        // by default this returns nullptr, w/ filters which don't override it
+        // thus reporting limit_exceeded as false
+
+        inline virtual symbol_stream<Symbol>* source() const noexcept { return nullptr; }
+
+
+        // filters forward the limit_exceeded of their upstream source, as a
+        // truncated upstream truncates the filter's output too
+
+        inline bool limit_exceeded() const noexcept override;
     };
 
 
     template<typename Symbol>
     inline symbol_filter<Symbol>::symbol_filter(std::shared_ptr<logger> lgr) 
         : symbol_stream(lgr) {}
+
+    template<typename Symbol>
+    inline bool symbol_filter<Symbol>::limit_exceeded() const noexcept {
+        const auto src = source();
+        return src && src->limit_exceeded();
+    }
 }
 
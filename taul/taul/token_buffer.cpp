@@ -0,0 +1,113 @@
+
+
+#include "token_buffer.h"
+
+#include <algorithm>
+
+#include "asserts.h"
+
+
+taul::token_buffer::token_buffer()
+    : _data_ptr(std::make_shared<const _data>(_data{ {}, token::end(0) })) {}
+
+taul::token_buffer::token_buffer(token_stream& src) {
+    _data d{ {}, token::end(0) };
+    while (true) {
+        const token tkn = src.next();
+        if (tkn.is_end()) {
+            d.end = tkn;
+            d.limit_exceeded = src.limit_exceeded();
+            break;
+        }
+        d.tokens.push_back(tkn);
+    }
+    d.tokens.shrink_to_fit();
+    _data_ptr = std::make_shared<const _data>(std::move(d));
+}
+
+taul::token_buffer::token_buffer(std::vector<token> tokens, token end) {
+    TAUL_ASSERT(end.is_end());
+    _data_ptr = std::make_shared<const _data>(_data{ std::move(tokens), end });
+}
+
+std::span<const taul::token> taul::token_buffer::tokens() const noexcept {
+    return std::span<const token>(_data_ptr->tokens);
+}
+
+taul::token taul::token_buffer::end() const noexcept {
+    return _data_ptr->end;
+}
+
+size_t taul::token_buffer::size() const noexcept {
+    return _data_ptr->tokens.size();
+}
+
+taul::token taul::token_buffer::at(size_t index) const noexcept {
+    TAUL_ASSERT(index <= size());
+    return
+        index < size()
+        ? _data_ptr->tokens[index]
+        : _data_ptr->end;
+}
+
+bool taul::token_buffer::limit_exceeded() const noexcept {
+    return _data_ptr->limit_exceeded;
+}
+
+std::shared_ptr<taul::token_buffer::cursor> taul::token_buffer::make_cursor(std::shared_ptr<logger> lgr) const {
+    return std::make_shared<cursor>(*this, lgr);
+}
+
+taul::token_buffer::cursor::cursor(const token_buffer& buffer, std::shared_ptr<logger> lgr)
+    : token_stream(lgr),
+    _data_ptr(buffer._data_ptr),
+    _observer(nullptr) {}
+
+void taul::token_buffer::cursor::bind_observer(token_observer* observer) {
+    _observer = observer;
+    _observer_ownership.reset();
+}
+
+void taul::token_buffer::cursor::bind_observer(std::shared_ptr<token_observer> observer) {
+    _observer = observer.get();
+    _observer_ownership = observer;
+}
+
+taul::token taul::token_buffer::cursor::peek() {
+    return _peek();
+}
+
+taul::token taul::token_buffer::cursor::next() {
+    token result = _peek();
+    if (_observer) _observer->observe(result);
+    if (_current < _data_ptr->tokens.size()) _current++; // advance input state
+    return result;
+}
+
+bool taul::token_buffer::cursor::done() {
+    return _current == _data_ptr->tokens.size();
+}
+
+void taul::token_buffer::cursor::reset() {
+    _current = 0;
+}
+
+bool taul::token_buffer::cursor::limit_exceeded() const noexcept {
+    return _current == _data_ptr->tokens.size() && _data_ptr->limit_exceeded;
+}
+
+size_t taul::token_buffer::cursor::position() const noexcept {
+    return _current;
+}
+
+void taul::token_buffer::cursor::seek(size_t position) noexcept {
+    _current = std::min(position, _data_ptr->tokens.size());
+}
+
+taul::token taul::token_buffer::cursor::_peek() const noexcept {
+    return
+        _current < _data_ptr->tokens.size()
+        ? _data_ptr->tokens[_current]
+        : _data_ptr->end;
+}
+
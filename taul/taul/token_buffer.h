@@ -0,0 +1,171 @@
+
+
+#pragma once
+
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "symbol_stream.h"
+
+
+namespace taul {
+
+
+    // token_buffer holds a fully lexed sequence of tokens, which
+    // may be consumed any number of times via independent cursors,
+    // w/out having to re-lex the input each time
+
+    // this is useful for things like trying multiple start rules,
+    // or re-parsing after a failed speculative parse
+
+    // token buffers are immutable, and share their tokens w/ their
+    // copies and their cursors, making copying them cheap, and
+    // letting cursors safely outlive the buffer they came from
+
+
+    class token_buffer final {
+    public:
+
+        class cursor;
+
+
+        // default initializes an empty token buffer, w/ an end-of-input
+        // token at source pos 0
+
+        token_buffer();
+
+        // initializes a token buffer from the tokens of src, up to and
+        // including its first end-of-input token
+
+        // src is read via 'next' calls from its current position
+
+        token_buffer(token_stream& src);
+
+        // initializes a token buffer from tokens, followed by end
+
+        // behaviour is undefined if any of tokens are end-of-input tokens
+
+        // behaviour is undefined if end is not an end-of-input token
+
+        token_buffer(std::vector<token> tokens, token end);
+
+        token_buffer(const token_buffer&) = default;
+        token_buffer(token_buffer&&) noexcept = default;
+
+        ~token_buffer() noexcept = default;
+
+        token_buffer& operator=(const token_buffer&) = default;
+        token_buffer& operator=(token_buffer&&) noexcept = default;
+
+
+        // tokens returns the tokens of the buffer, excluding the end-of-input token
+
+        std::span<const token> tokens() const noexcept;
+
+        // end returns the end-of-input token of the buffer
+
+        token end() const noexcept;
+
+        // size returns the number of tokens, excluding the end-of-input token
+
+        size_t size() const noexcept;
+
+        // at returns the token at index, w/ the end-of-input token
+        // being returned for index == size()
+
+        // behaviour is undefined if index > size()
+
+        token at(size_t index) const noexcept;
+
+        // limit_exceeded returns if the stream the buffer was initialized from
+        // reported limit_exceeded upon reaching end-of-input, ie. if the buffer's
+        // tokens were cut short
+
+        bool limit_exceeded() const noexcept;
+
+
+        // make_cursor returns a new cursor at the start of the buffer
+
+        std::shared_ptr<cursor> make_cursor(std::shared_ptr<logger> lgr = nullptr) const;
+
+
+    private:
+
+        struct _data final {
+            std::vector<token> tokens;
+            token end;
+            bool limit_exceeded = false;
+        };
+
+        std::shared_ptr<const _data> _data_ptr;
+
+
+        friend class cursor;
+    };
+
+
+    // token_buffer::cursor is a token stream reading from a token buffer,
+    // w/ each cursor having its own read position
+
+    // cursors are cheap, w/ any number of them being able to be used
+    // concurrently across threads, so long as each cursor is only
+    // used by one thread at a time
+
+    class token_buffer::cursor final : public token_stream {
+    public:
+
+        cursor(const token_buffer& buffer, std::shared_ptr<logger> lgr = nullptr);
+
+        virtual ~cursor() noexcept = default;
+
+
+        virtual void bind_observer(token_observer* observer) override final;
+        virtual void bind_observer(std::shared_ptr<token_observer> observer) override final;
+        virtual token peek() override final;
+        virtual token next() override final;
+        virtual bool done() override final;
+
+        // reset rewinds the cursor to the start of the buffer
+
+        void reset() override final;
+
+        // limit_exceeded returns the buffer's limit_exceeded once the cursor
+        // reaches end-of-input, so downstream components see the truncation
+        // at the same point they would've w/ the buffer's source stream
+
+        bool limit_exceeded() const noexcept override final;
+
+
+        // position returns the read position of the cursor, as an
+        // index into the buffer's tokens
+
+        // position == size() when the cursor is at end-of-input
+
+        size_t position() const noexcept;
+
+        // seek sets the read position of the cursor, w/ positions beyond
+        // end-of-input being clamped to end-of-input
+
+        // this is intended to be used w/ position to backtrack
+        // after a failed speculative parse
+
+        void seek(size_t position) noexcept;
+
+
+    private:
+
+        std::shared_ptr<const _data> _data_ptr;
+        size_t _current = 0;
+
+        token_observer* _observer;
+        std::shared_ptr<token_observer> _observer_ownership;
+
+
+        // these help avoid virtual call indirection
+
+        token _peek() const noexcept;
+    };
+}
+
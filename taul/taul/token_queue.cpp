@@ -0,0 +1,74 @@
+
+
+#include "token_queue.h"
+
+
+taul::token_queue::token_queue(std::shared_ptr<logger> lgr)
+    : token_stream(lgr),
+    _observer(nullptr) {}
+
+void taul::token_queue::bind_observer(token_observer* observer) {
+    _observer = observer;
+    _observer_ownership.reset();
+}
+
+void taul::token_queue::bind_observer(std::shared_ptr<token_observer> observer) {
+    _observer = observer.get();
+    _observer_ownership = observer;
+}
+
+taul::token taul::token_queue::peek() {
+    return _peek();
+}
+
+taul::token taul::token_queue::next() {
+    token result = _peek();
+    if (_observer) _observer->observe(result);
+    if (_current < _tokens.size()) _current++; // advance input state
+    return result;
+}
+
+bool taul::token_queue::done() {
+    return _end && _current == _tokens.size();
+}
+
+void taul::token_queue::reset() {
+    _current = 0;
+}
+
+void taul::token_queue::push(token tkn) {
+    TAUL_ASSERT(!_end);
+    if (tkn.is_end()) _end = tkn;
+    else _tokens.push_back(tkn);
+    _high_pos = tkn.high_pos();
+}
+
+void taul::token_queue::clear() {
+    _tokens.clear();
+    _current = 0;
+    _end.reset();
+    _high_pos = 0;
+}
+
+bool taul::token_queue::ready() const noexcept {
+    return _end || _current < _tokens.size();
+}
+
+bool taul::token_queue::finished() const noexcept {
+    return _end.has_value();
+}
+
+void taul::token_queue::discard() {
+    _tokens.erase(_tokens.begin(), _tokens.begin() + _current);
+    _current = 0;
+}
+
+size_t taul::token_queue::buffered() const noexcept {
+    return _tokens.size();
+}
+
+taul::token taul::token_queue::_peek() const {
+    if (_current < _tokens.size()) return _tokens[_current];
+    return _end.value_or(token::end(_high_pos)); // fail safe
+}
+
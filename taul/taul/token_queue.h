@@ -0,0 +1,90 @@
+
+
+#pragma once
+
+
+#include <deque>
+
+#include "symbol_stream.h"
+
+
+namespace taul {
+
+
+    // token_queue is a token stream who's tokens are pushed to it
+    // incrementally, w/ the queue being used to feed a parser in
+    // *push mode* (see parser::bind_push_source)
+
+    // pushing an end-of-input token finishes the queue, w/ the 
+    // queue not ending prior to this
+
+    // prior to finishing, querying a token which has yet to be pushed
+    // returns an end-of-input token, w/ ready being used to check
+    // if this would occur
+
+
+    class token_queue final : public token_stream {
+    public:
+
+        token_queue(std::shared_ptr<logger> lgr = nullptr);
+
+        virtual ~token_queue() noexcept = default;
+
+
+        virtual void bind_observer(token_observer* observer) override final;
+        virtual void bind_observer(std::shared_ptr<token_observer> observer) override final;
+        virtual token peek() override final;
+        virtual token next() override final;
+        virtual bool done() override final;
+
+        // reset rewinds the queue to the start of its non-discarded tokens
+
+        void reset() override final;
+
+
+        // push pushes tkn to the back of the queue
+
+        // behaviour is undefined if called after the queue has finished
+
+        void push(token tkn);
+
+        // clear discards all tokens, and undoes finishing, letting the
+        // queue be reused for new input
+
+        void clear();
+
+        // ready returns if the next token of the queue is available
+
+        bool ready() const noexcept;
+
+        // finished returns if an end-of-input token has been pushed
+
+        bool finished() const noexcept;
+
+        // discard frees tokens prior to the current read position,
+        // which may no longer be read again, ie. via reset
+
+        void discard();
+
+        // buffered returns the number of tokens currently held
+
+        size_t buffered() const noexcept;
+
+
+    private:
+
+        std::deque<token> _tokens; // the non-discarded tokens, excluding _end
+        size_t _current = 0; // the read position, as an index into _tokens
+        std::optional<token> _end; // the end-of-input token, if finished
+        source_pos _high_pos = 0; // the high pos of the last pushed token
+
+        token_observer* _observer;
+        std::shared_ptr<token_observer> _observer_ownership;
+
+
+        // these help avoid virtual call indirection
+
+        token _peek() const;
+    };
+}
+
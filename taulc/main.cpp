@@ -34,7 +34,9 @@ void exec_compile(
     const std::string& source_path,
     const std::string& output_path,
     std::optional<std::string> include_path_value = std::nullopt,
-    bool has_triangle_brackets = false);
+    bool has_triangle_brackets = false,
+    bool use_image = false,
+    bool use_predictors = false);
 
 
 int32_t main(int32_t argc, const char** argv) {
@@ -69,7 +71,7 @@ int32_t main(int32_t argc, const char** argv) {
         else if (args.expect("compile")) {
             message("Synopsis:");
             message("");
-            message("    taulc compile <fetcher> <source-path> <output-path> [[--include-path|-i]=<include-path> [--triangle-brackets|-t]]");
+            message("    taulc compile <fetcher> <source-path> <output-path> [[--include-path|-i]=<include-path> [--triangle-brackets|-t]] [--image|-m] [--direct-coded|-d]");
             message("");
             message("Compiles the TAUL spec file at <source-path>, if any, and if successful, outputs");
             message("a C++ header file to <output-path>, with this generated header file encapsulating");
@@ -93,6 +95,14 @@ int32_t main(int32_t argc, const char** argv) {
             message("No checks are made to ensure <include-path> is syntactic in C++.");
             message("");
             message("If <include-path> is not provided, 'taul' will be presumed.");
+            message("");
+            message("If --image is provided, the grammar will be embedded in the generated header file");
+            message("as a static array containing its binary image, rather than as a serialized string,");
+            message("making the header file larger, but the grammar faster to load.");
+            message("");
+            message("If --direct-coded is provided, the generated header file will also contain C++ code");
+            message("performing the grammar's parse table lookups directly, rather than via tables,");
+            message("making the header file larger, but lexing and parsing faster.");
         }
         else if (const auto unrecognized = args.next()) {
             error("Cannot provide help for unrecognized command '{0}'!", *unrecognized);
@@ -127,9 +137,15 @@ int32_t main(int32_t argc, const char** argv) {
         if (fetcher && source_path && output_path) {
             if (const auto include_path_value = args.expect_ext({ "--include-path", "-i" })) {
                 const bool has_triangle_brackets = args.expect({ "--triangle-brackets", "-t" });
-                exec_compile(*fetcher, *source_path, *output_path, include_path_value, has_triangle_brackets);
+                const bool use_image = args.expect({ "--image", "-m" });
+                const bool use_predictors = args.expect({ "--direct-coded", "-d" });
+                exec_compile(*fetcher, *source_path, *output_path, include_path_value, has_triangle_brackets, use_image, use_predictors);
+            }
+            else {
+                const bool use_image = args.expect({ "--image", "-m" });
+                const bool use_predictors = args.expect({ "--direct-coded", "-d" });
+                exec_compile(*fetcher, *source_path, *output_path, std::nullopt, false, use_image, use_predictors);
             }
-            else exec_compile(*fetcher, *source_path, *output_path);
         }
         else error("Missing or invalid command arguments!");
     }
@@ -157,7 +173,9 @@ void exec_compile(
     const std::string& source_path,
     const std::string& output_path,
     std::optional<std::string> include_path_value,
-    bool has_triangle_brackets) {
+    bool has_triangle_brackets,
+    bool use_image,
+    bool use_predictors) {
     const auto in_path = std::filesystem::path(source_path);
     const auto out_path = std::filesystem::path(output_path);
     if (!std::filesystem::exists(in_path)) {
@@ -170,8 +188,8 @@ void exec_compile(
         message("TAUL spec file compilation succeeded!");
         const auto generated_code =
             include_path_value
-            ? taul::export_fetcher(*loaded, fetcher.c_str(), include_path_value->c_str(), has_triangle_brackets)
-            : taul::export_fetcher(*loaded, fetcher.c_str());
+            ? taul::export_fetcher(*loaded, fetcher.c_str(), include_path_value->c_str(), has_triangle_brackets, "    ", use_image, use_predictors)
+            : taul::export_fetcher(*loaded, fetcher.c_str(), "taul", false, "    ", use_image, use_predictors);
         if (!generated_code.to_file(out_path)) {
             error("TAUL spec file output failed!");
         }
@@ -0,0 +1,146 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/regular_error_handler.h>
+#include <taul/batch_parser.h>
+
+#include "helpers/test_listener.h"
+#include "helpers/test_items_grammar.h"
+
+
+using namespace taul::string_literals;
+
+
+static std::vector<taul::str> make_batch_parser_tests_inputs(size_t n) {
+    // include some documents w/ errors, and some empty ones
+    const std::vector<std::string> fragments{ "abc ", "{de {f} g} ", "} ", "{h} ", "", "{ ", "x ", "{{{y}}} " };
+    std::vector<taul::str> result{};
+    for (size_t i = 0; i < n; i++) {
+        std::string doc{};
+        for (size_t j = 0; j < i % 7; j++) doc += fragments[(i + j * 3) % fragments.size()];
+        result.push_back(taul::str(doc));
+    }
+    return result;
+}
+
+TEST(BatchParserTests, Parse) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto inputs = make_batch_parser_tests_inputs(1000);
+
+    // parse sequentially, for comparison
+
+    taul::source_reader rdr{};
+    taul::lexer lxr(gram.value(), lgr);
+    lxr.bind_source(&rdr);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+    taul::regular_error_handler eh(lgr);
+    psr.bind_error_handler(&eh);
+
+    std::vector<taul::parse_tree> expected{};
+    std::vector<test_listener> expected_lstnrs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        rdr.change_input(inputs[i]);
+        psr.bind_listener(&expected_lstnrs[i]);
+        psr.reset();
+        expected.push_back(psr.parse("Top"_str));
+    }
+
+    for (const size_t workers : { size_t(1), size_t(4) }) {
+        TAUL_LOG(lgr, "workers=={}", workers);
+
+        taul::batch_parser bp(gram.value(), workers, lgr);
+        bp.bind_error_handler_factory([lgr]() { return std::make_shared<taul::regular_error_handler>(lgr); });
+
+        EXPECT_EQ(bp.workers(), workers);
+
+        // parse multiple batches, to test reuse
+
+        for (size_t batch = 0; batch < 3; batch++) {
+            std::vector<test_listener> lstnrs(inputs.size());
+            const auto results = bp.parse("Top"_str, inputs, [&](size_t index) { return &lstnrs[index]; });
+
+            ASSERT_EQ(results.size(), expected.size());
+            for (size_t i = 0; i < results.size(); i++) {
+                EXPECT_EQ(results[i], expected[i]) << "i==" << i;
+                EXPECT_EQ(lstnrs[i].output, expected_lstnrs[i].output) << "i==" << i;
+            }
+        }
+    }
+}
+
+TEST(BatchParserTests, ParseNoTree) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto inputs = make_batch_parser_tests_inputs(500);
+
+    taul::source_reader rdr{};
+    taul::lexer lxr(gram.value(), lgr);
+    lxr.bind_source(&rdr);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    std::vector<test_listener> expected_lstnrs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        rdr.change_input(inputs[i]);
+        psr.bind_listener(&expected_lstnrs[i]);
+        psr.reset();
+        psr.parse_notree("Top"_str);
+    }
+
+    taul::batch_parser bp(gram.value(), 3, lgr);
+
+    std::vector<test_listener> lstnrs(inputs.size());
+    bp.parse_notree("Top"_str, inputs, [&](size_t index) { return &lstnrs[index]; });
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        EXPECT_EQ(lstnrs[i].output, expected_lstnrs[i].output) << "i==" << i;
+    }
+}
+
+TEST(BatchParserTests, EmptyBatch) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::batch_parser bp(gram.value(), 2, lgr);
+
+    EXPECT_TRUE(bp.parse("Top"_str, std::span<const taul::str>{}).empty());
+}
+
+
+TEST(BatchParserTests, ManySmallBatches) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    // lots of tiny back-to-back batches, w/ fewer documents than workers, so
+    // workers from one batch are still likely to be looking for work when the
+    // next batch starts
+
+    const auto inputs = make_batch_parser_tests_inputs(16);
+
+    taul::batch_parser bp(gram.value(), 8, lgr);
+
+    for (size_t batch = 0; batch < 20000; batch++) {
+        const size_t n = 1 + batch % 2;
+        const std::span<const taul::str> batch_inputs(inputs.data() + batch % 11, n);
+        std::vector<size_t> parsed(n, 0);
+        bp.parse_notree("Top"_str, batch_inputs, [&](size_t index) { parsed[index]++; return nullptr; });
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(parsed[i], 1) << "batch==" << batch << ", i==" << i;
+        }
+    }
+}
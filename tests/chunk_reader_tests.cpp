@@ -0,0 +1,138 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/chunk_reader.h>
+
+#include "parameterized_tests/glyph_stream_tests.h"
+
+
+using namespace taul::string_literals;
+
+
+// test w/ non-empty input
+
+static GlyphStreamParam _make_param_1() {
+    auto stream = std::make_shared<taul::chunk_reader>();
+    stream->feed(std::string_view("abc"));
+    stream->feed(std::string_view("def"));
+    stream->finish();
+    std::size_t n_after_done = 6;
+    return GlyphStreamParam::init(stream, n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ChunkReader_NonEmptyInput,
+    GlyphStreamTests, 
+    testing::Values(_make_param_1()));
+
+
+// test w/ empty input
+
+static GlyphStreamParam _make_param_2() {
+    auto stream = std::make_shared<taul::chunk_reader>();
+    stream->finish();
+    std::size_t n_after_done = 0;
+    return GlyphStreamParam::init(stream, n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ChunkReader_EmptyInput,
+    GlyphStreamTests, 
+    testing::Values(_make_param_2()));
+
+
+TEST(ChunkReaderTests, Starvation) {
+    taul::chunk_reader rdr{};
+
+    EXPECT_FALSE(rdr.starved());
+    EXPECT_FALSE(rdr.done());
+    EXPECT_EQ(rdr.peek(), taul::glyph::end(0));
+    EXPECT_TRUE(rdr.starved());
+
+    rdr.unstarve();
+    rdr.feed(std::string_view("ab"));
+
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'a', 0));
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'b', 1));
+    EXPECT_FALSE(rdr.starved());
+    EXPECT_EQ(rdr.next(), taul::glyph::end(2));
+    EXPECT_TRUE(rdr.starved());
+    EXPECT_FALSE(rdr.done());
+
+    rdr.unstarve();
+    rdr.feed(std::string_view("c"));
+    rdr.finish();
+
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'c', 2));
+    EXPECT_TRUE(rdr.done());
+    EXPECT_EQ(rdr.next(), taul::glyph::end(3));
+    EXPECT_FALSE(rdr.starved());
+}
+
+TEST(ChunkReaderTests, PartialUnits) {
+    const auto input = taul::convert_encoding<char>(taul::utf8, taul::utf8, u8"a魂💩").value();
+    ASSERT_EQ(input.length(), 8);
+
+    taul::chunk_reader rdr{};
+
+    // feed one char at a time, w/ the multi-char units being split
+
+    std::vector<taul::glyph> glyphs{};
+    for (const auto& c : input) {
+        rdr.feed(std::string_view(&c, 1));
+        while (true) {
+            rdr.unstarve();
+            const auto g = rdr.peek();
+            if (rdr.starved()) break;
+            glyphs.push_back(rdr.next());
+        }
+    }
+    rdr.finish();
+
+    EXPECT_TRUE(rdr.done());
+
+    std::vector<taul::glyph> expected{
+        taul::glyph::normal(U'a', 0, 1),
+        taul::glyph::normal(U'魂', 1, 3),
+        taul::glyph::normal(U'💩', 4, 4),
+    };
+
+    EXPECT_EQ(glyphs, expected);
+}
+
+TEST(ChunkReaderTests, DiscardAndCheckpoints) {
+    taul::chunk_reader rdr{};
+
+    rdr.feed(std::string_view("abcd"));
+
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'a', 0));
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'b', 1));
+
+    rdr.discard();
+
+    EXPECT_EQ(rdr.buffered(), 2);
+
+    const auto cp = rdr.checkpoint();
+
+    EXPECT_EQ(cp, 2);
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'c', 2));
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'd', 3));
+
+    rdr.restore(cp);
+
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'c', 2));
+
+    // reset rewinds to the start of non-discarded input
+
+    rdr.reset();
+
+    EXPECT_EQ(rdr.next(), taul::glyph::normal(U'c', 2));
+
+    rdr.clear();
+
+    EXPECT_EQ(rdr.buffered(), 0);
+    EXPECT_FALSE(rdr.finished());
+    EXPECT_EQ(rdr.checkpoint(), 0);
+}
+
@@ -0,0 +1,151 @@
+
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/export_fetcher.h>
+#include <taul/taul_gram.h>
+
+#include <taul/internal/grammar_data.h>
+
+
+using namespace taul::string_literals;
+
+
+static taul::grammar make_grammar() {
+    const auto spec =
+        taul::spec_writer()
+        .lpr_decl("A"_str)
+        .ppr_decl("Start"_str)
+        .lpr("A"_str)
+        .string("a")
+        .close()
+        .ppr("Start"_str)
+        .name("A"_str)
+        .close()
+        .done();
+    return taul::load(spec).value();
+}
+
+
+// these traits defer generating their data until runtime, rather than embedding
+// it as export_fetcher would
+
+struct serial_str_traits final {
+    static std::string_view get_serial_str() noexcept {
+        static const auto serialized = make_grammar().serialize();
+        return serialized;
+    }
+};
+
+struct image_traits final {
+    static std::span<const uint8_t> get_image() noexcept {
+        static const auto image = make_grammar().image();
+        return image;
+    }
+};
+
+
+template<typename Traits>
+static void test_fetch() {
+    using singleton_t = taul::internal::export_fetcher_singleton<Traits>;
+
+    const auto gram = singleton_t::fetch();
+    ASSERT_TRUE(gram.has_lpr("A"_str));
+    ASSERT_TRUE(gram.has_ppr("Start"_str));
+    EXPECT_EQ(gram.serialize(), make_grammar().serialize());
+
+    // test that concurrent fetches all return the same shared grammar state
+
+    constexpr size_t threads = 8;
+    std::vector<std::optional<taul::grammar>> results(threads);
+    std::vector<std::thread> workers{};
+    for (size_t i = 0; i < threads; i++) {
+        workers.emplace_back([&results, i] { results[i] = singleton_t::fetch(); });
+    }
+    for (auto& I : workers) I.join();
+    for (const auto& I : results) {
+        ASSERT_TRUE(I);
+        EXPECT_TRUE(I->is_associated(gram.lpr_at(0)));
+        EXPECT_TRUE(I->is_associated(gram.ppr_at(0)));
+    }
+}
+
+
+TEST(ExportFetcherTests, FetchSerialStr) {
+    test_fetch<serial_str_traits>();
+}
+
+TEST(ExportFetcherTests, FetchImage) {
+    test_fetch<image_traits>();
+}
+
+TEST(ExportFetcherTests, ExportImage) {
+    const auto gram = make_grammar();
+
+    // can't compile output, so just check that it embeds the image, rather than
+    // a serialized string
+
+    const auto src_serial_str = taul::export_fetcher(gram, "abc");
+    const auto src_image = taul::export_fetcher(gram, "abc", "taul", false, "    ", true);
+    
+    const auto txt_serial_str = std::string(src_serial_str.str());
+    const auto txt_image = std::string(src_image.str());
+
+    EXPECT_NE(txt_serial_str.find("get_serial_str"), std::string::npos);
+    EXPECT_EQ(txt_serial_str.find("get_image"), std::string::npos);
+    EXPECT_EQ(txt_image.find("get_serial_str"), std::string::npos);
+    EXPECT_NE(txt_image.find("get_image"), std::string::npos);
+    EXPECT_NE(txt_image.find("0x54,0x41,0x55,0x4c,"), std::string::npos); // "TAUL"
+}
+
+// predictors are piecewise constant over the ID ranges of their parse table's
+// ID groups, so testing the bounds of each group suffices to test all IDs
+
+template<typename Symbol>
+static void test_predictor(const taul::internal::parse_table<Symbol>& pt) {
+    using traits_t = taul::symbol_traits<Symbol>;
+    ASSERT_TRUE(pt.predictor);
+
+    // test that predictor agrees w/ parse table for all non-terminal/terminal pairs
+
+    for (const auto& [nonterminal, set] : pt.first_sets_A) {
+        for (const auto& range : pt.grouper.ranges) {
+            for (const auto terminal : { range.low, range.high }) {
+                const auto expected = pt.lookup(nonterminal, pt.grouper(terminal));
+                const auto actual = pt.predictor(nonterminal, terminal);
+                ASSERT_EQ(actual, expected) << "nonterminal == " << size_t(nonterminal) << ", terminal == " << size_t(terminal);
+            }
+        }
+    }
+
+    // test that non-terminals w/out mappings are rejected
+
+    EXPECT_FALSE(pt.predictor(traits_t::last_nonterminal_id, traits_t::end_of_input_id));
+}
+
+TEST(ExportFetcherTests, Predictors) {
+    const auto gram = taul::taul_gram(); // <- uses generated predictors
+    const auto& gramdat = taul::internal::launder_grammar_data(gram);
+    test_predictor(gramdat._lpr_pt);
+    test_predictor(gramdat._ppr_pt);
+}
+
+TEST(ExportFetcherTests, ExportPredictors) {
+    const auto gram = make_grammar();
+
+    const auto src_without = std::string(taul::export_fetcher(gram, "abc").str());
+    const auto src_with = std::string(taul::export_fetcher(gram, "abc", "taul", false, "    ", false, true).str());
+
+    EXPECT_EQ(src_without.find("predict_lpr"), std::string::npos);
+    EXPECT_EQ(src_without.find("predict_ppr"), std::string::npos);
+    EXPECT_NE(src_with.find("predict_lpr"), std::string::npos);
+    EXPECT_NE(src_with.find("predict_ppr"), std::string::npos);
+    EXPECT_NE(src_with.find("// A"), std::string::npos);
+    EXPECT_NE(src_with.find("// Start"), std::string::npos);
+}
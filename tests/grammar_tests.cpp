@@ -1215,6 +1215,21 @@ TEST(GrammarTests, Serialization) {
     ASSERT_TRUE(gram1->has_ppr("Number"_str));
     ASSERT_TRUE(gram1->has_ppr("Expr"_str));
 
+    // test that deserialized grammar's FIRST/FOLLOW/prefix sets were preserved
+
+    for (size_t i = 0; i < gram0->lprs(); i++) {
+        EXPECT_EQ(gram1->lpr_at(i).first_set(), gram0->lpr_at(i).first_set());
+        EXPECT_EQ(gram1->lpr_at(i).follow_set(), gram0->lpr_at(i).follow_set());
+        EXPECT_EQ(gram1->lpr_at(i).prefix_set(), gram0->lpr_at(i).prefix_set());
+    }
+    for (size_t i = 0; i < gram0->pprs(); i++) {
+        EXPECT_EQ(gram1->ppr_at(i).first_set(), gram0->ppr_at(i).first_set());
+        EXPECT_EQ(gram1->ppr_at(i).follow_set(), gram0->ppr_at(i).follow_set());
+        EXPECT_EQ(gram1->ppr_at(i).prefix_set(), gram0->ppr_at(i).prefix_set());
+    }
+
+    EXPECT_EQ(gram1->serialize(), serialized);
+
     // test that deserialized grammar behaves as expected
 
     const auto input = "a + b + a + a + b"_str;
@@ -1266,3 +1281,85 @@ TEST(GrammarTests, Serialization) {
     EXPECT_TRUE(expected.match(actual));
 }
 
+
+TEST(GrammarTests, Image) {
+    const auto lgr = taul::make_stderr_logger();
+    const auto spec =
+        taul::spec_writer()
+        .lpr_decl("A"_str)
+        .lpr_decl("B"_str)
+        .ppr_decl("AB"_str)
+        .lpr("A"_str)
+        .string("a")
+        .close()
+        .lpr("B"_str)
+        .string("b")
+        .close()
+        .ppr("AB"_str)
+        .name("A"_str)
+        .name("B"_str)
+        .close()
+        .done();
+    const auto gram0 = taul::load(spec, lgr);
+    ASSERT_TRUE(gram0);
+
+    const auto image = gram0->image();
+
+    // image should be smaller than serialize output, as it's not base64 encoded
+
+    EXPECT_LT(image.size(), gram0->serialize().length());
+
+    const auto gram1 = taul::grammar::from_image(image);
+    ASSERT_TRUE(gram1);
+
+    TAUL_LOG(lgr, "{}", *gram1);
+
+    ASSERT_TRUE(gram1->has_lpr("A"_str));
+    ASSERT_TRUE(gram1->has_lpr("B"_str));
+    ASSERT_TRUE(gram1->has_ppr("AB"_str));
+
+    EXPECT_EQ(gram1->serialize(), gram0->serialize());
+    EXPECT_EQ(gram1->image(), image);
+
+    // test that bad magic number, truncation, and trailing bytes are rejected
+
+    auto bad_magic = image;
+    bad_magic[0] = 'X';
+    EXPECT_FALSE(taul::grammar::from_image(bad_magic));
+    for (size_t i = 0; i < image.size(); i++) {
+        EXPECT_FALSE(taul::grammar::from_image(std::span(image.data(), i))) << "i == " << i;
+    }
+    auto trailing = image;
+    trailing.push_back(0);
+    EXPECT_FALSE(taul::grammar::from_image(trailing));
+
+    // test that image need not outlive the grammar
+
+    std::optional<taul::grammar> gram2{};
+    {
+        const auto temp = gram0->image();
+        gram2 = taul::grammar::from_image(temp);
+    }
+    ASSERT_TRUE(gram2);
+
+    taul::source_reader rdr("ab"_str);
+    taul::lexer lxr(*gram2);
+    taul::parser psr(*gram2);
+    taul::no_recovery_error_handler eh(lgr);
+    lxr.bind_source(&rdr);
+    psr.bind_source(&lxr);
+    psr.bind_error_handler(&eh);
+    psr.reset();
+
+    taul::source_pos_counter cntr{};
+    const auto expected =
+        taul::parse_tree_pattern(*gram2)
+        .syntactic("AB"_str, cntr())
+        .lexical("A"_str, cntr(1), 1)
+        .lexical("B"_str, cntr(1), 1)
+        .close();
+
+    auto actual = psr.parse("AB"_str);
+
+    EXPECT_TRUE(expected.match(actual));
+}
@@ -0,0 +1,96 @@
+
+
+#pragma once
+
+
+#include <memory>
+#include <optional>
+
+#include <taul/logger.h>
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+
+
+// the grammar used by tests of the various parsing pipeline components, of
+// whitespace separated idents, and {...} blocks of nested items, w/ options
+// for the variations of it some tests need
+
+//      ws      : ' '+ ;        (skip, w/ '\n' too if newlines)
+//      ident   : [a-z]+ ;
+//      lb      : '{' ;
+//      rb      : '}' ;
+//      semi    : ';' ;         (only if semi_prefix)
+//
+//      Top     : Item* ;       (w/ semi prefix if semi_prefix, and end suffix if end_anchored)
+//      Item    : ident | lb Item* rb ;     (w/ 'ident ident?' if ident_pairs)
+
+struct test_items_grammar_options final {
+    bool end_anchored = false;
+    bool newlines = false;
+    bool semi_prefix = false;
+    bool ident_pairs = false;
+};
+
+inline std::optional<taul::grammar> make_test_items_grammar(std::shared_ptr<taul::logger> lgr, const test_items_grammar_options& opts = {}) {
+    using namespace taul::string_literals;
+    taul::spec_writer sw{};
+    sw
+        .lpr_decl("ws"_str)
+        .lpr_decl("ident"_str)
+        .lpr_decl("lb"_str)
+        .lpr_decl("rb"_str);
+    if (opts.semi_prefix) sw.lpr_decl("semi"_str);
+    sw
+        .ppr_decl("Top"_str)
+        .ppr_decl("Item"_str)
+        .lpr("ws"_str, taul::skip)
+        .kleene_plus()
+        .charset(opts.newlines ? " \\n"_str : " "_str)
+        .close()
+        .close()
+        .lpr("ident"_str)
+        .kleene_plus()
+        .charset("a-z"_str)
+        .close()
+        .close()
+        .lpr("lb"_str)
+        .string("{"_str)
+        .close()
+        .lpr("rb"_str)
+        .string("}"_str)
+        .close();
+    if (opts.semi_prefix) {
+        sw
+            .lpr("semi"_str)
+            .string(";"_str)
+            .close();
+    }
+    sw.ppr("Top"_str);
+    if (opts.semi_prefix) sw.name("semi"_str);
+    sw
+        .kleene_star()
+        .name("Item"_str)
+        .close();
+    if (opts.end_anchored) sw.end();
+    sw
+        .close()
+        .ppr("Item"_str)
+        .name("ident"_str);
+    if (opts.ident_pairs) {
+        sw
+            .optional()
+            .name("ident"_str)
+            .close();
+    }
+    sw
+        .alternative()
+        .name("lb"_str)
+        .kleene_star()
+        .name("Item"_str)
+        .close()
+        .name("rb"_str)
+        .close();
+    return taul::load(sw.done(), lgr);
+}
+
@@ -89,6 +89,80 @@ TEST(IDGrouperTests, Glyph_NonInit) {
     EXPECT_EQ(grouper.get_symbol_range(14), range14);
 }
 
+TEST(IDGrouperTests, Glyph_AddUseCases) {
+    using traits_t = taul::symbol_traits<taul::glyph>;
+
+    const std::vector<taul::glyph_range> use_cases{
+        taul::glyph_range{ taul::cp_id(U'*'), taul::cp_id(U'*') },
+        taul::glyph_range{ taul::cp_id(U'3'), taul::cp_id(U'8') },
+        taul::glyph_range{ taul::cp_id(U'?'), taul::cp_id(U'?') },
+        taul::glyph_range{ taul::cp_id(U'B'), taul::cp_id(U'D') },
+        taul::glyph_range{ taul::cp_id(U'a'), taul::cp_id(U'f') },
+        taul::glyph_range{ taul::cp_id(U'C'), taul::cp_id(U'b') },
+        taul::glyph_range{ taul::cp_id(U'魂'), taul::cp_id(U'魂') },
+        taul::glyph_range{ taul::cp_id(U'3'), taul::cp_id(U'8') }, // <- duplicate
+        taul::glyph_range{ taul::cp_id(U'魂'), traits_t::last_id },
+        taul::glyph_range{ traits_t::first_id, traits_t::first_id },
+    };
+
+    taul::internal::id_grouper<taul::glyph> expected{};
+    for (const auto& I : use_cases) expected.add_use_case(I.low, I.high);
+
+    taul::internal::id_grouper<taul::glyph> grouper{};
+    grouper.add_use_cases(use_cases);
+
+    EXPECT_EQ(grouper.ranges, expected.ranges);
+
+    // bulk adding atop of existing groups must preserve them
+
+    taul::internal::id_grouper<taul::glyph> grouper2{};
+    grouper2.add_use_case(taul::cp_id(U'x'), taul::cp_id(U'z'));
+    grouper2.add_use_cases(use_cases);
+
+    expected.add_use_case(taul::cp_id(U'x'), taul::cp_id(U'z'));
+
+    EXPECT_EQ(grouper2.ranges, expected.ranges);
+}
+
+TEST(IDGrouperTests, Glyph_GetGroupSpan) {
+    taul::internal::id_grouper<taul::glyph> grouper{};
+
+    const std::vector<taul::glyph_range> use_cases{
+        taul::glyph_range{ taul::cp_id(U'a'), taul::cp_id(U'f') },
+        taul::glyph_range{ taul::cp_id(U'C'), taul::cp_id(U'b') },
+        taul::glyph_range{ taul::cp_id(U'魂'), taul::cp_id(U'魂') },
+    };
+    grouper.add_use_cases(use_cases);
+
+    for (const auto& I : use_cases) {
+        const auto span = grouper.get_group_span(I.low, I.high);
+        EXPECT_EQ(span.low, grouper(I.low));
+        EXPECT_EQ(span.high, grouper(I.high));
+        EXPECT_EQ(grouper.get_symbol_range(span.low).low, I.low);
+        EXPECT_EQ(grouper.get_symbol_range(span.high).high, I.high);
+    }
+
+    EXPECT_EQ(grouper.get_group_span(taul::cp_id(U'C'), taul::cp_id(U'f')), (taul::internal::group_span{ 1, 3 }));
+}
+
+TEST(IDGrouperTests, Token_AddUseCases) {
+    using traits_t = taul::symbol_traits<taul::token>;
+
+    std::vector<taul::token_range> use_cases{};
+    for (std::uint32_t i = 0; i < 200; i++) {
+        use_cases.push_back(taul::token_range{ taul::lpr_id((i * 37) % 500), taul::lpr_id((i * 37) % 500 + i % 7) });
+    }
+    use_cases.push_back(taul::token_range{ traits_t::first_id, traits_t::last_id });
+
+    taul::internal::id_grouper<taul::token> expected{};
+    for (const auto& I : use_cases) expected.add_use_case(I.low, I.high);
+
+    taul::internal::id_grouper<taul::token> grouper{};
+    grouper.add_use_cases(use_cases);
+
+    EXPECT_EQ(grouper.ranges, expected.ranges);
+}
+
 // see id_grouper.h for why this is commented out
 
 // also, I COULD write some tests to replace below... but I'm lazy, so I haven't, lol,
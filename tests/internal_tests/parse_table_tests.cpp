@@ -535,6 +535,44 @@ TEST(ParseTableTests, Token_WithEmptyAlternative) {
     if (a6) EXPECT_EQ(a6.value(), 2);
 }
 
+TEST(ParseTableTests, Token_RecoverySets) {
+    ns::parse_table_build_details<taul::token> details{};
+    const ns::parse_table<taul::token> table =
+        ns::parse_table<taul::token>()
+        .add_rule(taul::ppr_id(0))
+        .add_terminal(0, 0, 2)
+        .add_rule(taul::ppr_id(0))
+        .add_terminal(1, 5, 70, true)
+        .add_rule(taul::ppr_id(1))
+        .add_nonterminal(2, taul::ppr_id(0), ns::no_preced_val)
+        .add_terminal(2, 100, 200)
+        .add_rule(taul::ppr_id(1))
+        .add_terminal(3, taul::lpr_id(150), TAUL_LAST_NORMAL_ID(lpr))
+        .add_rule(taul::ppr_id(1)) // the empty alternative
+        .build_mappings(details);
+
+    TAUL_LOG(taul::make_stderr_logger(), "{}\n{}", table.fmt(), details.fmt(table.grouper));
+
+    EXPECT_TRUE(details.collisions.empty());
+
+    std::vector<taul::symbol_id> inputs{};
+    for (taul::symbol_id_num i = 0; i <= 220; i++) inputs.push_back(taul::lpr_id(i));
+    inputs.push_back(TAUL_LAST_NORMAL_ID(lpr));
+    inputs.push_back(taul::failure_lpr_id);
+    inputs.push_back(taul::end_lpr_id);
+
+    for (const auto& nonterminal : { taul::ppr_id(0), taul::ppr_id(1) }) {
+        const auto rs = table.fetch_recovery_set(nonterminal);
+        ASSERT_TRUE(rs);
+        for (const auto& input : inputs) {
+            EXPECT_EQ(rs->contains(input), table.lookup(nonterminal, table.grouper(input)).has_value())
+                << "nonterminal==" << taul::fmt_symbol_id(nonterminal) << ", input==" << taul::fmt_symbol_id(input);
+        }
+    }
+
+    EXPECT_FALSE(table.fetch_recovery_set(taul::ppr_id(2)));
+}
+
 TEST(ParseTableTests, Token_Ambiguity) {
     ns::parse_table_build_details<taul::token> details{};
     const ns::parse_table<taul::token> table =
@@ -614,3 +652,195 @@ TEST(ParseTableTests, Token_LeftRecursion) {
     EXPECT_FALSE(details.collisions.empty()); // not gonna bother asserting *what* collision details should be
 }
 
+
+TEST(ParseTableTests, Token_Serialization) {
+    ns::parse_table_build_details<taul::token> details{};
+    const ns::parse_table<taul::token> table =
+        ns::parse_table<taul::token>()
+        .add_rule(taul::ppr_id(0))
+        .add_terminal(0, 0, 2)
+        .add_rule(taul::ppr_id(0))
+        .add_terminal(1, 5, 70, true)
+        .add_rule(taul::ppr_id(1))
+        .add_nonterminal(2, taul::ppr_id(0), ns::no_preced_val)
+        .add_terminal(2, 100, 200)
+        .add_rule(taul::ppr_id(1)) // the empty alternative
+        .build_mappings(details);
+
+    ns::buff b{};
+    table.serialize(b);
+
+    const auto check = [&](const ns::parse_table<taul::token>& x) {
+        EXPECT_EQ(x.rules.size(), table.rules.size());
+        EXPECT_EQ(x.grouper.ranges, table.grouper.ranges);
+        EXPECT_EQ(x.mappings, table.mappings);
+        EXPECT_EQ(x.first_sets_A, table.first_sets_A);
+        EXPECT_EQ(x.follow_sets_A, table.follow_sets_A);
+        EXPECT_EQ(x.prefix_sets_A, table.prefix_sets_A);
+        EXPECT_EQ(x.recovery_sets, table.recovery_sets);
+    };
+
+    // version 2 loads the built table
+
+    {
+        ns::buff_reader rdr(b);
+        const auto x = ns::parse_table<taul::token>::deserialize(rdr, 2);
+        ASSERT_TRUE(x);
+        EXPECT_EQ(rdr.remaining(), 0);
+        check(*x);
+
+        ns::buff b2{};
+        x->serialize(b2);
+        EXPECT_EQ(b2.bytes, b.bytes); // output is deterministic
+    }
+
+    // version 1 rebuilds the table from its rules, ignoring the rest
+
+    {
+        ns::buff_reader rdr(b);
+        const auto x = ns::parse_table<taul::token>::deserialize(rdr, 1);
+        ASSERT_TRUE(x);
+        EXPECT_GT(rdr.remaining(), 0);
+        check(*x);
+    }
+
+    // unknown versions, and truncated data, fail
+
+    {
+        ns::buff_reader rdr(b);
+        EXPECT_FALSE(ns::parse_table<taul::token>::deserialize(rdr, 3));
+        EXPECT_EQ(rdr.offset, 0);
+    }
+    for (size_t n = 0; n < b.size(); n++) {
+        ns::buff truncated{};
+        truncated.bytes.assign(b.bytes.begin(), b.bytes.begin() + n);
+        ns::buff_reader rdr(truncated);
+        EXPECT_FALSE(ns::parse_table<taul::token>::deserialize(rdr, 2)) << "n==" << n;
+    }
+}
+
+static std::string fmt_rules(const auto& table) {
+    std::string result{};
+    for (const auto& I : table.rules) result += I.fmt() + "\n";
+    return result;
+}
+
+TEST(ParseTableTests, Glyph_Optimize) {
+    const auto first_helper_id = taul::lpr_id(2);
+    ns::parse_table<taul::glyph> table =
+        ns::parse_table<taul::glyph>()
+        .add_rule(taul::lpr_id(0))
+        .add_terminal(0, U'x', U'x')
+        .add_nonterminal(0, taul::lpr_id(2), ns::signal_preced_val)
+        .add_terminal(0, U'y', U'y')
+        .add_rule(taul::lpr_id(2)) // adjacent single terminal alternatives, merged, then inlined
+        .add_terminal(1, U'c', U'c')
+        .add_rule(taul::lpr_id(2))
+        .add_terminal(2, U'a', U'b')
+        .add_rule(taul::lpr_id(1))
+        .add_nonterminal(3, taul::lpr_id(3), ns::signal_preced_val)
+        .add_terminal(3, U'z', U'z')
+        .add_rule(taul::lpr_id(3)) // epsilon-only, collapsed
+        .add_rule(taul::lpr_id(1))
+        .add_nonterminal(5, taul::lpr_id(5), ns::signal_preced_val)
+        .add_rule(taul::lpr_id(4)) // unreachable, removed
+        .add_terminal(6, U'q', U'q')
+        .add_rule(taul::lpr_id(5)) // non-adjacent single terminal alternatives, kept
+        .add_terminal(7, U'm', U'm')
+        .add_rule(taul::lpr_id(5))
+        .add_terminal(8, U'o', U'o')
+        .add_rule(taul::lpr_id(6)) // self-recursive, kept
+        .add_terminal(9, U'r', U'r')
+        .add_nonterminal(9, taul::lpr_id(6), ns::signal_preced_val)
+        .add_rule(taul::lpr_id(1))
+        .add_nonterminal(10, taul::lpr_id(6), ns::signal_preced_val);
+    table.optimize(first_helper_id);
+
+    const ns::parse_table<taul::glyph> expected =
+        ns::parse_table<taul::glyph>()
+        .add_rule(taul::lpr_id(0))
+        .add_terminal(0, U'x', U'x')
+        .add_terminal(0, U'a', U'c')
+        .add_terminal(0, U'y', U'y')
+        .add_rule(taul::lpr_id(1))
+        .add_terminal(1, U'z', U'z')
+        .add_rule(taul::lpr_id(1))
+        .add_nonterminal(2, taul::lpr_id(5), ns::signal_preced_val)
+        .add_rule(taul::lpr_id(5))
+        .add_terminal(3, U'm', U'm')
+        .add_rule(taul::lpr_id(5))
+        .add_terminal(4, U'o', U'o')
+        .add_rule(taul::lpr_id(6))
+        .add_terminal(5, U'r', U'r')
+        .add_nonterminal(5, taul::lpr_id(6), ns::signal_preced_val)
+        .add_rule(taul::lpr_id(1))
+        .add_nonterminal(6, taul::lpr_id(6), ns::signal_preced_val);
+
+    EXPECT_EQ(fmt_rules(table), fmt_rules(expected));
+
+    ns::parse_table_build_details<taul::glyph> details{};
+    table.build_mappings(details);
+
+    EXPECT_TRUE(details.no_internal_errors());
+    EXPECT_TRUE(details.collisions.empty());
+}
+
+TEST(ParseTableTests, Glyph_Optimize_PreservesAmbiguity) {
+    const auto first_helper_id = taul::lpr_id(1);
+    ns::parse_table<taul::glyph> table =
+        ns::parse_table<taul::glyph>()
+        .add_rule(taul::lpr_id(0))
+        .add_nonterminal(0, taul::lpr_id(1), ns::signal_preced_val)
+        .add_rule(taul::lpr_id(1)) // overlapping, so not merged
+        .add_terminal(1, U'a', U'c')
+        .add_rule(taul::lpr_id(1))
+        .add_terminal(2, U'c', U'd');
+    table.optimize(first_helper_id);
+
+    EXPECT_EQ(table.rules.size(), 3);
+
+    ns::parse_table_build_details<taul::glyph> details{};
+    table.build_mappings(details);
+
+    EXPECT_FALSE(details.collisions.empty());
+}
+
+TEST(ParseTableTests, Token_Optimize) {
+    const auto first_helper_id = taul::ppr_id(1);
+    ns::parse_table<taul::token> table =
+        ns::parse_table<taul::token>()
+        .add_rule(taul::ppr_id(0))
+        .add_nonterminal(0, taul::ppr_id(1), ns::signal_preced_val)
+        .add_nonterminal(0, taul::ppr_id(2), ns::signal_preced_val)
+        .add_nonterminal(0, taul::ppr_id(3), ns::signal_preced_val)
+        .add_rule(taul::ppr_id(1)) // non-nullable, so kept, but w/ alternatives merged
+        .add_terminal(1, 0, 2)
+        .add_rule(taul::ppr_id(1))
+        .add_terminal(2, 3, 3)
+        .add_rule(taul::ppr_id(2)) // epsilon-only, collapsed
+        .add_rule(taul::ppr_id(3)) // nullable, inlined
+        .add_nonterminal(4, taul::ppr_id(4), ns::signal_preced_val)
+        .add_rule(taul::ppr_id(4))
+        .add_rule(taul::ppr_id(4))
+        .add_terminal(6, 10, 10);
+    table.optimize(first_helper_id);
+
+    const ns::parse_table<taul::token> expected =
+        ns::parse_table<taul::token>()
+        .add_rule(taul::ppr_id(0))
+        .add_nonterminal(0, taul::ppr_id(1), ns::signal_preced_val)
+        .add_nonterminal(0, taul::ppr_id(4), ns::signal_preced_val)
+        .add_rule(taul::ppr_id(1))
+        .add_terminal(1, 0, 3)
+        .add_rule(taul::ppr_id(4))
+        .add_rule(taul::ppr_id(4))
+        .add_terminal(3, 10, 10);
+
+    EXPECT_EQ(fmt_rules(table), fmt_rules(expected));
+
+    ns::parse_table_build_details<taul::token> details{};
+    table.build_mappings(details);
+
+    EXPECT_TRUE(details.no_internal_errors());
+    EXPECT_TRUE(details.collisions.empty());
+}
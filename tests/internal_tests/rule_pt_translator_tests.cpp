@@ -0,0 +1,120 @@
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <taul/logger.h>
+#include <taul/spec.h>
+#include <taul/spec_error.h>
+#include <taul/load.h>
+
+
+using namespace taul::string_literals;
+
+
+// rule_pt_translator optimizes its parse tables prior to building them, but upon
+// the build reporting errors, it rebuilds them from the unoptimized rules, w/ these
+// tests checking that the diagnostics reported are those of the unoptimized rules
+
+// the expected outputs below are those of loading prior to the optimizer's addition
+
+
+class recording_logger final : public taul::logger {
+public:
+
+    std::vector<std::string> lines;
+
+
+    // sorted, as collisions are reported in unordered_set order
+
+    inline std::vector<std::string> sorted() const {
+        auto result = lines;
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+
+protected:
+
+    inline void on_log(const std::string& msg) override {
+        lines.push_back(msg);
+    }
+};
+
+
+TEST(RulePTTranslatorTests, DiagnosticsOfUnoptimizedRules_Ambiguity) {
+    const auto lgr = std::make_shared<recording_logger>();
+    taul::spec_error_counter ec{};
+
+    // lpr0's ('a' | 'b') helper would be merged into [a-b], and inlined, if
+    // the optimized rules were used, reducing the two collisions to one
+
+    const auto s =
+        taul::spec_writer()
+        .lpr_decl("lpr0"_str)
+        .ppr_decl("ppr0"_str)
+        .lpr("lpr0"_str)
+        .sequence()
+        .string("a"_str)
+        .alternative()
+        .string("b"_str)
+        .close()
+        .string("x"_str)
+        .alternative()
+        .charset("a-c"_str)
+        .string("y"_str)
+        .close()
+        .ppr("ppr0"_str)
+        .sequence()
+        .name("lpr0"_str)
+        .close()
+        .alternative()
+        .name("lpr0"_str)
+        .close()
+        .done();
+
+    const auto gram = taul::load(s, ec, lgr);
+
+    EXPECT_FALSE(gram);
+    EXPECT_EQ(ec.total(), 3);
+    EXPECT_EQ(ec.count(taul::spec_error::illegal_ambiguity), 3);
+
+    const std::vector<std::string> expected{
+        "TAUL error: lpr0 is ambiguous over the inputs (cp:'a')! (illegal-ambiguity)",
+        "TAUL error: lpr0 is ambiguous over the inputs (cp:'b')! (illegal-ambiguity)",
+        "TAUL error: ppr0 is ambiguous over the inputs (lpr:0 (lpr0))! (illegal-ambiguity)",
+    };
+    EXPECT_EQ(lgr->sorted(), expected);
+}
+
+TEST(RulePTTranslatorTests, DiagnosticsOfUnoptimizedRules_LeftRecursion) {
+    const auto lgr = std::make_shared<recording_logger>();
+    taul::spec_error_counter ec{};
+
+    // lpr0's (lpr0 'z') helper would be inlined if the optimized rules were used,
+    // reducing the two rules w/ left-recursion to one
+
+    const auto s =
+        taul::spec_writer()
+        .lpr_decl("lpr0"_str)
+        .lpr("lpr0"_str)
+        .sequence()
+        .name("lpr0"_str)
+        .string("z"_str)
+        .close()
+        .close()
+        .done();
+
+    const auto gram = taul::load(s, ec, lgr);
+
+    EXPECT_FALSE(gram);
+    EXPECT_EQ(ec.total(), 2);
+    EXPECT_EQ(ec.count(taul::spec_error::illegal_ambiguity), 2);
+
+    const std::vector<std::string> expected{
+        "TAUL error: lpr:0 (lpr0) is ambiguous due to left-recursion! (illegal-ambiguity)",
+        "TAUL error: lpr:1 is ambiguous due to left-recursion! (illegal-ambiguity)",
+    };
+    EXPECT_EQ(lgr->sorted(), expected);
+}
@@ -0,0 +1,191 @@
+
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/listener_bus.h>
+
+#include "helpers/test_listener.h"
+#include "helpers/test_items_grammar.h"
+
+
+using namespace taul::string_literals;
+
+
+static taul::str make_listener_bus_tests_input(size_t items) {
+    std::string result{};
+    for (size_t i = 0; i < items; i++) result += i % 2 == 0 ? "abc " : "{de {f}} ";
+    return taul::str(result);
+}
+
+static void parse_for_listener_bus_tests(const taul::grammar& gram, const taul::str& input, taul::listener* lstnr) {
+    taul::source_reader rdr(input);
+    taul::lexer lxr(gram);
+    lxr.bind_source(&rdr);
+    taul::parser psr(gram);
+    psr.bind_source(&lxr);
+    psr.bind_listener(lstnr);
+    psr.reset();
+    psr.parse_notree("Top"_str);
+}
+
+// test_listener wrapper which blocks upon on_startup until released
+
+class gated_listener final : public taul::listener {
+public:
+
+    test_listener inner{};
+    std::atomic<bool> released = false;
+
+
+    inline void on_startup() override {
+        released.wait(false);
+        inner.on_startup();
+    }
+
+    inline void on_shutdown() override { inner.on_shutdown(); }
+    inline void on_lexical(taul::token tkn) override { inner.on_lexical(tkn); }
+    inline void on_syntactic(taul::ppr_ref ppr, taul::source_pos pos) override { inner.on_syntactic(ppr, pos); }
+    inline void on_close() override { inner.on_close(); }
+    inline void on_abort() override { inner.on_abort(); }
+    inline void on_terminal_error(taul::token_range ids, taul::token input) override { inner.on_terminal_error(ids, input); }
+    inline void on_nonterminal_error(taul::symbol_id id, taul::token input) override { inner.on_nonterminal_error(id, input); }
+
+    inline void release() {
+        released.store(true);
+        released.notify_all();
+    }
+};
+
+TEST(ListenerBusTests, FanOut) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), { .end_anchored = true });
+    ASSERT_TRUE(gram);
+
+    // include a syntax error, so error events are included
+
+    const auto input = taul::str(std::string(std::string_view(make_listener_bus_tests_input(500))) + "}");
+
+    test_listener expected{};
+    parse_for_listener_bus_tests(gram.value(), input, &expected);
+
+    ASSERT_GT(expected.terminal_errors + expected.nonterminal_errors, 0);
+
+    taul::listener_bus bus{};
+    test_listener a{}, b{};
+    auto c = std::make_shared<test_listener>();
+
+    EXPECT_EQ(bus.subscribe(&a), 0);
+    EXPECT_EQ(bus.subscribe(&b, taul::listener_bus::overflow_policy::block, 8), 1);
+    EXPECT_EQ(bus.subscribe(c), 2);
+    EXPECT_EQ(bus.consumers(), 3);
+
+    for (size_t i = 0; i < 2; i++) {
+        parse_for_listener_bus_tests(gram.value(), input, &bus);
+    }
+    bus.wait();
+
+    const auto expected_output = expected.output + expected.output;
+
+    for (const test_listener* x : { &a, &b, c.get() }) {
+        EXPECT_EQ(x->output, expected_output);
+        EXPECT_EQ(x->terminal_errors, expected.terminal_errors * 2);
+        EXPECT_EQ(x->nonterminal_errors, expected.nonterminal_errors * 2);
+    }
+    EXPECT_EQ(bus.overflows(0), 0);
+    EXPECT_EQ(bus.overflows(1), 0);
+    EXPECT_EQ(bus.overflows(2), 0);
+}
+
+TEST(ListenerBusTests, Backpressure) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), { .end_anchored = true });
+    ASSERT_TRUE(gram);
+
+    const auto input = make_listener_bus_tests_input(500);
+
+    test_listener expected{};
+    parse_for_listener_bus_tests(gram.value(), input, &expected);
+
+    // the parser blocks upon the consumer's queue filling, so starting
+    // parsing prior to releasing the consumer requires another thread
+
+    taul::listener_bus bus{};
+    gated_listener gated{};
+    bus.subscribe(&gated, taul::listener_bus::overflow_policy::block, 4);
+
+    std::atomic<bool> done = false;
+    std::thread t([&] {
+        parse_for_listener_bus_tests(gram.value(), input, &bus);
+        done.store(true);
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(done.load());
+
+    gated.release();
+    t.join();
+    bus.wait();
+
+    EXPECT_EQ(gated.inner.output, expected.output);
+    EXPECT_EQ(bus.overflows(0), 0);
+}
+
+TEST(ListenerBusTests, Drop) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), { .end_anchored = true });
+    ASSERT_TRUE(gram);
+
+    const auto input = make_listener_bus_tests_input(500);
+
+    test_listener expected{};
+    parse_for_listener_bus_tests(gram.value(), input, &expected);
+
+    taul::listener_bus bus{};
+    gated_listener gated{};
+    test_listener fast{};
+    bus.subscribe(&gated, taul::listener_bus::overflow_policy::drop, 16);
+    bus.subscribe(&fast);
+
+    // the slow consumer mustn't hold up parsing, nor the other consumer
+
+    parse_for_listener_bus_tests(gram.value(), input, &bus);
+
+    EXPECT_EQ(bus.overflows(0), 1);
+
+    gated.release();
+    bus.wait();
+
+    EXPECT_EQ(fast.output, expected.output);
+
+    // the slow consumer should see a prefix of the events, followed by
+    // on_abort and on_shutdown
+
+    const std::string suffix = "\non_abort()\non_shutdown()";
+    const auto& output = gated.inner.output;
+
+    ASSERT_GT(output.size(), suffix.size());
+    EXPECT_EQ(output.substr(output.size() - suffix.size()), suffix);
+    EXPECT_TRUE(expected.output.starts_with(output.substr(0, output.size() - suffix.size())));
+    EXPECT_LT(output.size(), expected.output.size());
+
+    // w/ its queue now empty, the slow consumer is reconnected for the next
+    // parse, w/ its input being small enough to not overflow
+
+    const auto small_input = make_listener_bus_tests_input(1);
+
+    test_listener small_expected{};
+    parse_for_listener_bus_tests(gram.value(), small_input, &small_expected);
+
+    gated.inner.output.clear();
+    parse_for_listener_bus_tests(gram.value(), small_input, &bus);
+    bus.wait();
+
+    EXPECT_EQ(gated.inner.output, small_expected.output);
+    EXPECT_EQ(bus.overflows(0), 1);
+}
+
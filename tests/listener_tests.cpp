@@ -13,6 +13,46 @@
 using namespace taul::string_literals;
 
 
+static taul::grammar make_playback_test_grammar(const std::shared_ptr<taul::logger>& lgr) {
+    auto spec =
+        taul::spec_writer()
+        .lpr_decl("a"_str)
+        .lpr_decl("b"_str)
+        .lpr_decl("c"_str)
+        .ppr_decl("A"_str)
+        .ppr_decl("B"_str)
+        .lpr("a"_str)
+        .close()
+        .lpr("b"_str)
+        .close()
+        .lpr("c"_str)
+        .close()
+        .ppr("A"_str)
+        .close()
+        .ppr("B"_str)
+        .close()
+        .done();
+    auto loaded = taul::load(spec, lgr);
+    TAUL_ASSERT(loaded);
+    return std::move(*loaded);
+}
+
+static taul::parse_tree make_playback_test_tree(const taul::grammar& gram) {
+    return
+        taul::parse_tree(gram)
+        .syntactic(gram.ppr("A"_str).value(), 0)
+        .lexical(gram.lpr("a"_str).value(), 0, 1)
+        .syntactic(gram.ppr("B"_str).value(), 1)
+        .lexical(gram.lpr("a"_str).value(), 1, 1)
+        .lexical(gram.lpr("b"_str).value(), 2, 1)
+        .lexical(gram.lpr("c"_str).value(), 3, 1)
+        .close()
+        .lexical(gram.lpr("c"_str).value(), 4, 1)
+        .lexical(taul::token::failure(5))
+        .close()
+        .abort();
+}
+
 std::string build_expected_output(taul::grammar gram) {
     TAUL_ASSERT(gram.has_lpr("a"_str));
     TAUL_ASSERT(gram.has_lpr("b"_str));
@@ -95,3 +135,119 @@ TEST(ListenerTests, Playback) {
     EXPECT_EQ(expected_output, lstnr.output);
 }
 
+
+TEST(ListenerTests, Playback_Filter) {
+    auto lgr = taul::make_stderr_logger();
+    taul::grammar gram = make_playback_test_grammar(lgr);
+    taul::parse_tree pt = make_playback_test_tree(gram);
+
+    // report A and B, but skip the lexical nodes of A, and only
+    // report the 'b' lexical node of B
+
+    const auto ppr_A = gram.ppr("A"_str).value();
+    const auto ppr_B = gram.ppr("B"_str).value();
+    const auto lpr_b = gram.lpr("b"_str).value();
+
+    test_listener expected{};
+    expected.on_startup();
+    expected.on_syntactic(ppr_A, 0);
+    expected.on_syntactic(ppr_B, 1);
+    expected.on_lexical(taul::token::normal(gram, "b"_str, 2, 1));
+    expected.on_close();
+    expected.on_close();
+    expected.on_abort();
+    expected.on_shutdown();
+
+    size_t visited = 0;
+    auto filter =
+        [&](const taul::parse_tree::node& nd) -> taul::playback_action {
+        visited++;
+        if (nd.is_syntactic()) return taul::playback_action::report;
+        if (nd.id() == lpr_b.id()) return taul::playback_action::report;
+        return taul::playback_action::skip;
+        };
+
+    test_listener lstnr{};
+    lstnr.playback(pt, filter);
+
+    TAUL_LOG(lgr,
+        "\nexpected_output:\n{}\n\nlstnr.output:\n{}",
+        expected.output, lstnr.output);
+
+    EXPECT_EQ(expected.output, lstnr.output);
+    EXPECT_EQ(visited, pt.nodes());
+}
+
+TEST(ListenerTests, Playback_Filter_SkipSubtree) {
+    auto lgr = taul::make_stderr_logger();
+    taul::grammar gram = make_playback_test_grammar(lgr);
+    taul::parse_tree pt = make_playback_test_tree(gram);
+
+    const auto ppr_B = gram.ppr("B"_str).value();
+
+    test_listener expected{};
+    expected.on_startup();
+    expected.on_syntactic(gram.ppr("A"_str).value(), 0);
+    expected.on_lexical(taul::token::normal(gram, "a"_str, 0, 1));
+    expected.on_lexical(taul::token::normal(gram, "c"_str, 4, 1));
+    expected.on_lexical(taul::token::failure(5));
+    expected.on_close();
+    expected.on_abort();
+    expected.on_shutdown();
+
+    // the nodes of B's subtree should never be visited
+
+    size_t visited = 0;
+    auto filter =
+        [&](const taul::parse_tree::node& nd) -> taul::playback_action {
+        visited++;
+        return
+            nd.id() == ppr_B.id()
+            ? taul::playback_action::skip
+            : taul::playback_action::report;
+        };
+
+    test_listener lstnr{};
+    lstnr.playback(pt, filter);
+
+    TAUL_LOG(lgr,
+        "\nexpected_output:\n{}\n\nlstnr.output:\n{}",
+        expected.output, lstnr.output);
+
+    EXPECT_EQ(expected.output, lstnr.output);
+    EXPECT_EQ(visited, pt.nodes() - 3);
+}
+
+TEST(ListenerTests, Playback_IDs) {
+    auto lgr = taul::make_stderr_logger();
+    taul::grammar gram = make_playback_test_grammar(lgr);
+    taul::parse_tree pt = make_playback_test_tree(gram);
+
+    // B is reported in its entirety, while the 'c' lexical nodes are
+    // reported wherever they're found
+
+    test_listener expected{};
+    expected.on_startup();
+    expected.on_syntactic(gram.ppr("B"_str).value(), 1);
+    expected.on_lexical(taul::token::normal(gram, "a"_str, 1, 1));
+    expected.on_lexical(taul::token::normal(gram, "b"_str, 2, 1));
+    expected.on_lexical(taul::token::normal(gram, "c"_str, 3, 1));
+    expected.on_close();
+    expected.on_lexical(taul::token::normal(gram, "c"_str, 4, 1));
+    expected.on_abort();
+    expected.on_shutdown();
+
+    const std::unordered_set<taul::symbol_id> ids{
+        gram.ppr("B"_str).value().id(),
+        gram.lpr("c"_str).value().id(),
+    };
+
+    test_listener lstnr{};
+    lstnr.playback(pt, ids);
+
+    TAUL_LOG(lgr,
+        "\nexpected_output:\n{}\n\nlstnr.output:\n{}",
+        expected.output, lstnr.output);
+
+    EXPECT_EQ(expected.output, lstnr.output);
+}
@@ -0,0 +1,136 @@
+
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <taul/grammar.h>
+#include <taul/load.h>
+
+
+using namespace taul::string_literals;
+
+
+class LoadCachedTests : public testing::Test {
+public:
+
+    std::shared_ptr<taul::logger> lgr;
+    std::filesystem::path dir, src_path, cache_dir;
+
+
+    inline void SetUp() override final {
+        lgr = taul::make_stderr_logger();
+        dir = std::filesystem::temp_directory_path() / "taul_load_cached_tests";
+        src_path = dir / "spec.taul";
+        cache_dir = dir / "cache";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    inline void TearDown() override final {
+        std::error_code ec{};
+        std::filesystem::remove_all(dir, ec);
+    }
+
+
+    inline void write_src(std::string_view x) {
+        std::ofstream ofs(src_path, std::ios::binary | std::ios::trunc);
+        ofs << x;
+    }
+
+    inline size_t cache_entries() const {
+        size_t result = 0;
+        if (std::filesystem::exists(cache_dir)) {
+            for (const auto& I : std::filesystem::directory_iterator(cache_dir)) {
+                EXPECT_EQ(I.path().extension(), ".taulimg"); // <- no temporary files left behind
+                result++;
+            }
+        }
+        return result;
+    }
+};
+
+
+TEST_F(LoadCachedTests, MissThenHit) {
+    write_src("lexer section: A : 'a' ; parser section: Start : A ;");
+
+    const auto expected = taul::load(src_path, lgr);
+    ASSERT_TRUE(expected);
+
+    EXPECT_EQ(cache_entries(), 0);
+
+    const auto gram0 = taul::load_cached(src_path, cache_dir, lgr); // miss
+    ASSERT_TRUE(gram0);
+    EXPECT_EQ(gram0->serialize(), expected->serialize());
+    EXPECT_EQ(cache_entries(), 1);
+
+    const auto gram1 = taul::load_cached(src_path, cache_dir, lgr); // hit
+    ASSERT_TRUE(gram1);
+    EXPECT_EQ(gram1->serialize(), expected->serialize());
+    EXPECT_EQ(cache_entries(), 1);
+}
+
+TEST_F(LoadCachedTests, SourceEditsResultInMiss) {
+    write_src("lexer section: A : 'a' ; parser section: Start : A ;");
+
+    const auto gram0 = taul::load_cached(src_path, cache_dir, lgr);
+    ASSERT_TRUE(gram0);
+    EXPECT_TRUE(gram0->has_lpr("A"_str));
+    EXPECT_EQ(cache_entries(), 1);
+
+    write_src("lexer section: B : 'b' ; parser section: Start : B ;");
+
+    const auto gram1 = taul::load_cached(src_path, cache_dir, lgr);
+    ASSERT_TRUE(gram1);
+    EXPECT_FALSE(gram1->has_lpr("A"_str));
+    EXPECT_TRUE(gram1->has_lpr("B"_str));
+    EXPECT_EQ(cache_entries(), 2);
+}
+
+TEST_F(LoadCachedTests, DbgsymsArePartOfKey) {
+    write_src("lexer section: A : 'a' ; parser section: Start : A ;");
+
+    ASSERT_TRUE(taul::load_cached(src_path, cache_dir, lgr, true));
+    ASSERT_TRUE(taul::load_cached(src_path, cache_dir, lgr, false));
+    EXPECT_EQ(cache_entries(), 2);
+}
+
+TEST_F(LoadCachedTests, InvalidEntryIsReplaced) {
+    write_src("lexer section: A : 'a' ; parser section: Start : A ;");
+
+    ASSERT_TRUE(taul::load_cached(src_path, cache_dir, lgr));
+    ASSERT_EQ(cache_entries(), 1);
+
+    // corrupt cache entry
+
+    const auto entry_path = std::filesystem::directory_iterator(cache_dir)->path();
+    {
+        std::ofstream ofs(entry_path, std::ios::binary | std::ios::trunc);
+        ofs << "garbage";
+    }
+
+    const auto gram = taul::load_cached(src_path, cache_dir, lgr);
+    ASSERT_TRUE(gram);
+    EXPECT_TRUE(gram->has_lpr("A"_str));
+    EXPECT_EQ(cache_entries(), 1);
+
+    // test that entry was replaced w/ a valid one
+
+    std::ifstream ifs(entry_path, std::ios::binary);
+    const std::vector<uint8_t> image((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(image, gram->image());
+}
+
+TEST_F(LoadCachedTests, FailedLoadIsNotCached) {
+    write_src("lexer section: A : 'a' ; parser section: Start : Missing ;");
+
+    taul::spec_error_counter ec{};
+    EXPECT_FALSE(taul::load_cached(src_path, cache_dir, ec, lgr));
+    EXPECT_GE(ec.total(), 1);
+    EXPECT_EQ(cache_entries(), 0);
+}
+
+TEST_F(LoadCachedTests, MissingSource) {
+    EXPECT_FALSE(taul::load_cached(dir / "missing.taul", cache_dir, lgr));
+    EXPECT_EQ(cache_entries(), 0);
+}
@@ -0,0 +1,185 @@
+
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/parse_pipeline.h>
+
+#include "helpers/test_listener.h"
+#include "helpers/test_items_grammar.h"
+
+
+using namespace taul::string_literals;
+
+
+// we replace global operator new/delete in order to count heap allocations
+
+// this effects the whole test binary, but only by counting
+
+static std::atomic<size_t> heap_allocs = 0;
+
+void* operator new(std::size_t n) {
+    heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n == 0 ? 1 : n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+
+TEST(ParsePipelineTests, Parse) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger());
+    ASSERT_TRUE(gram);
+
+    taul::parse_pipeline pipeline(gram.value());
+
+    for (const auto& input : { "abc {de {f} g}"_str, ""_str, "{x} } y"_str, "a b c"_str }) {
+        taul::source_reader rdr(input);
+        taul::lexer lxr(gram.value());
+        lxr.bind_source(&rdr);
+        taul::parser psr(gram.value());
+        psr.bind_source(&lxr);
+        psr.reset();
+        const auto expected = psr.parse("Top"_str);
+
+        EXPECT_EQ(pipeline.parse(input, "Top"_str), expected);
+        EXPECT_EQ(pipeline.tree(), expected);
+        EXPECT_EQ(pipeline.tree().is_aborted(), expected.is_aborted());
+    }
+}
+
+TEST(ParsePipelineTests, ParseNoTree) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger());
+    ASSERT_TRUE(gram);
+
+    taul::parse_pipeline pipeline(gram.value());
+
+    for (const auto& input : { "abc {de {f} g}"_str, ""_str, "{x} } y"_str }) {
+        taul::source_reader rdr(input);
+        taul::lexer lxr(gram.value());
+        lxr.bind_source(&rdr);
+        taul::parser psr(gram.value());
+        psr.bind_source(&lxr);
+        test_listener expected{};
+        psr.bind_listener(&expected);
+        psr.reset();
+        psr.parse_notree("Top"_str);
+
+        test_listener lstnr{};
+        pipeline.bind_listener(&lstnr);
+        pipeline.parse_notree(input, "Top"_str);
+
+        EXPECT_EQ(lstnr.output, expected.output);
+    }
+}
+
+TEST(ParsePipelineTests, ZeroAllocSteadyState) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger());
+    ASSERT_TRUE(gram);
+
+    taul::parse_pipeline pipeline(gram.value());
+
+    const auto warm_up = "abc {de {f {g {h}}} i} jkl {m} {{n}} o"_str;
+    const auto input = "{x {y}} zw {} {{{a}}}"_str;
+
+    // warm up w/ an input which is larger, and more deeply nested, than input
+
+    for (size_t i = 0; i < 3; i++) {
+        pipeline.parse_notree(warm_up, "Top"_str);
+        pipeline.parse(warm_up, "Top"_str);
+    }
+
+    const auto ppr = gram->ppr("Top"_str).value();
+
+    size_t before = heap_allocs.load();
+    pipeline.parse_notree(input, ppr);
+    size_t after = heap_allocs.load();
+
+    EXPECT_EQ(after - before, 0);
+
+    before = heap_allocs.load();
+    const auto& result = pipeline.parse(input, ppr);
+    after = heap_allocs.load();
+
+    EXPECT_EQ(after - before, 0);
+    EXPECT_FALSE(result.is_aborted());
+    EXPECT_TRUE(result.is_sealed());
+}
+
+
+TEST(ParsePipelineTests, Limits) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger());
+    ASSERT_TRUE(gram);
+
+    taul::parse_pipeline pipeline(gram.value());
+
+    const auto nested = "{{{{{{{{x}}}}}}}}"_str;
+    const auto flat = "a b c d e f g h"_str;
+
+    // no limits
+
+    EXPECT_FALSE(pipeline.parse(nested, "Top"_str).is_aborted());
+    EXPECT_FALSE(pipeline.parse(flat, "Top"_str).is_aborted());
+    EXPECT_FALSE(pipeline.limit_exceeded());
+
+    // limits which go unexceeded
+
+    pipeline.limit(taul::parse_limits{
+        .max_depth = 100,
+        .max_lookahead = 100,
+        .max_nodes = 100,
+        .max_recoveries = 100,
+        .max_steps = 1000,
+        });
+
+    EXPECT_EQ(pipeline.parse(nested, "Top"_str), taul::parse_pipeline(gram.value()).parse(nested, "Top"_str));
+    EXPECT_FALSE(pipeline.tree().is_aborted());
+    EXPECT_FALSE(pipeline.limit_exceeded());
+
+    // limits which are exceeded
+
+    const std::vector<std::pair<taul::parse_limits, taul::str>> cases{
+        { taul::parse_limits{ .max_depth = 6 }, nested },
+        { taul::parse_limits{ .max_lookahead = 3 }, "abcdef"_str },
+        { taul::parse_limits{ .max_nodes = 5 }, flat },
+        { taul::parse_limits{ .max_steps = 10 }, flat },
+        { taul::parse_limits{ .max_recoveries = 0 }, "{a b"_str },
+    };
+
+    test_listener lstnr{};
+    pipeline.bind_listener(&lstnr);
+
+    for (const auto& [limits, input] : cases) {
+        pipeline.limit(limits);
+
+        lstnr.output.clear();
+        const auto& result = pipeline.parse(input, "Top"_str);
+
+        EXPECT_TRUE(result.is_aborted()) << "input==" << input;
+        EXPECT_TRUE(result.is_sealed()) << "input==" << input;
+        EXPECT_TRUE(pipeline.limit_exceeded()) << "input==" << input;
+        EXPECT_NE(lstnr.output.find("on_abort()"), std::string::npos) << "input==" << input;
+    }
+
+    // removing limits
+
+    pipeline.limit(taul::parse_limits{});
+
+    EXPECT_FALSE(pipeline.parse(nested, "Top"_str).is_aborted());
+    EXPECT_FALSE(pipeline.limit_exceeded());
+}
@@ -1123,3 +1123,47 @@ TEST_F(ParseTreeTests, Construction_SyntacticNodeAsRoot_Abort) {
     }
 }
 
+
+TEST_F(ParseTreeTests, Construction_SyntacticNodeAsRoot_Deferred) {
+    ASSERT_TRUE(ready);
+
+    auto a =
+        taul::parse_tree(gram)
+        .syntactic(gram.ppr("ppr"_str).value(), 1)
+        .deferred(gram.ppr("ppr"_str).value(), 2, 5)
+        .close();
+
+    ASSERT_TRUE(a.is_sealed());
+
+    EXPECT_FALSE(a.is_aborted());
+
+    ASSERT_EQ(a.nodes(), 2);
+
+    const auto& root = a.at(0);
+    EXPECT_FALSE(root.is_deferred());
+    EXPECT_EQ(root.pos(), 1);
+    EXPECT_EQ(root.len(), 6);
+    EXPECT_EQ(root.children(), 1);
+
+    const auto& nd = a.at(1);
+    EXPECT_TRUE(nd.is_syntactic());
+    EXPECT_TRUE(nd.is_deferred());
+    EXPECT_EQ(nd.ppr(), gram.ppr("ppr"_str));
+    EXPECT_EQ(nd.level(), 1);
+    EXPECT_EQ(nd.pos(), 2);
+    EXPECT_EQ(nd.len(), 5);
+    EXPECT_FALSE(nd.has_children());
+    EXPECT_EQ(nd.parent(), a.begin());
+
+    // placeholder nodes do not equal non-placeholder ones
+
+    auto b =
+        taul::parse_tree(gram)
+        .syntactic(gram.ppr("ppr"_str).value(), 1)
+        .syntactic(gram.ppr("ppr"_str).value(), 2)
+        .skip(5)
+        .close()
+        .close();
+
+    EXPECT_NE(a, b);
+}
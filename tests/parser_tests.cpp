@@ -6,9 +6,12 @@
 #include <taul/grammar.h>
 #include <taul/load.h>
 #include <taul/source_reader.h>
+#include <taul/lexer.h>
 #include <taul/parser.h>
+#include <taul/token_buffer.h>
 
 #include "parameterized_tests/base_parser_tests.h"
+#include "helpers/test_listener.h"
 
 
 using namespace taul::string_literals;
@@ -26,3 +29,563 @@ INSTANTIATE_TEST_SUITE_P(
     BaseParserTests,
     testing::Values(_make_param_1()));
 
+
+
+// these test features specific to taul::parser
+
+static std::optional<taul::grammar> make_parser_tests_grammar(std::shared_ptr<taul::logger> lgr) {
+    auto spec =
+        taul::spec_writer()
+        .lpr_decl("a"_str)
+        .lpr_decl("b"_str)
+        .lpr_decl("c"_str)
+        .ppr_decl("ABC"_str)
+        .ppr_decl("BB"_str)
+        .lpr("a"_str)
+        .string("a"_str)
+        .close()
+        .lpr("b"_str)
+        .string("b"_str)
+        .close()
+        .lpr("c"_str)
+        .string("c"_str)
+        .close()
+        .ppr("ABC"_str)
+        .name("a"_str)
+        .name("BB"_str)
+        .name("c"_str)
+        .close()
+        .ppr("BB"_str)
+        .name("b"_str)
+        .name("b"_str)
+        .close()
+        .done();
+    return taul::load(spec, lgr);
+}
+
+TEST(ParserTests, Omit_LPR) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::source_reader input("abbc"_str);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+
+    psr.omit(gram->lpr("a"_str).value());
+    psr.omit(gram->lpr("c"_str).value());
+
+    EXPECT_TRUE(psr.is_omitted(gram->lpr("a"_str).value()));
+    EXPECT_FALSE(psr.is_omitted(gram->lpr("b"_str).value()));
+    EXPECT_TRUE(psr.is_omitted(gram->lpr("c"_str).value()));
+
+    psr.reset();
+    auto result = psr.parse("ABC"_str);
+
+    // the root should still span all of the input, despite 'c' being omitted
+
+    auto expected =
+        taul::parse_tree(gram.value())
+        .syntactic("ABC"_str, 0)
+        .syntactic("BB"_str, 1)
+        .lexical("b"_str, 1, 1)
+        .lexical("b"_str, 2, 1)
+        .close()
+        .extend(4)
+        .close();
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result, expected);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result.root().len(), 4);
+
+    // omission should not effect listener events
+
+    test_listener expected_lstnr{};
+    expected_lstnr.on_startup();
+    expected_lstnr.on_syntactic(gram->ppr("ABC"_str).value(), 0);
+    expected_lstnr.on_lexical(taul::token::normal(gram.value(), "a"_str, 0, 1));
+    expected_lstnr.on_syntactic(gram->ppr("BB"_str).value(), 1);
+    expected_lstnr.on_lexical(taul::token::normal(gram.value(), "b"_str, 1, 1));
+    expected_lstnr.on_lexical(taul::token::normal(gram.value(), "b"_str, 2, 1));
+    expected_lstnr.on_close();
+    expected_lstnr.on_lexical(taul::token::normal(gram.value(), "c"_str, 3, 1));
+    expected_lstnr.on_close();
+    expected_lstnr.on_shutdown();
+
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+}
+
+TEST(ParserTests, Omit_PPR) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::source_reader input("abbc"_str);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    // the start rule should not be omitted, despite this
+
+    psr.omit(gram->ppr("ABC"_str).value());
+    psr.omit(gram->ppr("BB"_str).value());
+
+    psr.reset();
+    auto result = psr.parse("ABC"_str);
+
+    auto expected =
+        taul::parse_tree(gram.value())
+        .syntactic("ABC"_str, 0)
+        .lexical("a"_str, 0, 1)
+        .lexical("b"_str, 1, 1)
+        .lexical("b"_str, 2, 1)
+        .lexical("c"_str, 3, 1)
+        .close();
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result, expected);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(ParserTests, ClearOmissions) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::source_reader input("abbc"_str);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    psr.omit(gram->lpr("b"_str).value());
+    psr.omit(gram->ppr("BB"_str).value());
+    psr.clear_omissions();
+
+    EXPECT_FALSE(psr.is_omitted(gram->lpr("b"_str).value()));
+    EXPECT_FALSE(psr.is_omitted(gram->ppr("BB"_str).value()));
+
+    psr.reset();
+    auto result = psr.parse("ABC"_str);
+
+    auto expected =
+        taul::parse_tree(gram.value())
+        .syntactic("ABC"_str, 0)
+        .lexical("a"_str, 0, 1)
+        .syntactic("BB"_str, 1)
+        .lexical("b"_str, 1, 1)
+        .lexical("b"_str, 2, 1)
+        .close()
+        .lexical("c"_str, 3, 1)
+        .close();
+
+    EXPECT_EQ(result, expected);
+}
+
+static std::optional<taul::grammar> make_parser_tests_grammar_for_deferral(std::shared_ptr<taul::logger> lgr) {
+    auto spec =
+        taul::spec_writer()
+        .lpr_decl("lb"_str)
+        .lpr_decl("rb"_str)
+        .lpr_decl("x"_str)
+        .lpr_decl("y"_str)
+        .ppr_decl("Top"_str)
+        .ppr_decl("Block"_str)
+        .ppr_decl("Item"_str)
+        .lpr("lb"_str)
+        .string("{"_str)
+        .close()
+        .lpr("rb"_str)
+        .string("}"_str)
+        .close()
+        .lpr("x"_str)
+        .string("x"_str)
+        .close()
+        .lpr("y"_str)
+        .string("y"_str)
+        .close()
+        .ppr("Top"_str)
+        .name("Block"_str)
+        .name("y"_str)
+        .name("Block"_str)
+        .close()
+        .ppr("Block"_str)
+        .name("lb"_str)
+        .kleene_star()
+        .name("Item"_str)
+        .close()
+        .name("rb"_str)
+        .close()
+        .ppr("Item"_str)
+        .name("x"_str)
+        .alternative()
+        .name("Block"_str)
+        .close()
+        .done();
+    return taul::load(spec, lgr);
+}
+
+TEST(ParserTests, Defer) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto src = "{x{x}x}y{}"_str;
+
+    taul::source_reader input(src);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+
+    psr.defer(gram->ppr("Block"_str).value(), gram->lpr("lb"_str).value(), gram->lpr("rb"_str).value());
+
+    EXPECT_TRUE(psr.is_deferred(gram->ppr("Block"_str).value()));
+    EXPECT_FALSE(psr.is_deferred(gram->ppr("Item"_str).value()));
+
+    psr.reset();
+    auto result = psr.parse("Top"_str);
+
+    auto expected =
+        taul::parse_tree(gram.value())
+        .syntactic("Top"_str, 0)
+        .deferred(gram->ppr("Block"_str).value(), 0, 7)
+        .lexical("y"_str, 7, 1)
+        .deferred(gram->ppr("Block"_str).value(), 8, 2)
+        .close();
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result, expected);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_FALSE(result.is_aborted());
+
+    test_listener expected_lstnr{};
+    expected_lstnr.on_startup();
+    expected_lstnr.on_syntactic(gram->ppr("Top"_str).value(), 0);
+    expected_lstnr.on_syntactic(gram->ppr("Block"_str).value(), 0);
+    expected_lstnr.on_close();
+    expected_lstnr.on_lexical(taul::token::normal(gram.value(), "y"_str, 7, 1));
+    expected_lstnr.on_syntactic(gram->ppr("Block"_str).value(), 8);
+    expected_lstnr.on_close();
+    expected_lstnr.on_close();
+    expected_lstnr.on_shutdown();
+
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+
+    // expanding placeholders should give us the parse tree we'd have gotten
+    // had parsing not been deferred, w/ nested Blocks being deferred again
+    // upon expanding those enclosing them, requiring further expansion
+
+    // omit lb, to test that expanded subtrees reflect the parser's omissions
+
+    psr.omit(gram->lpr("lb"_str).value());
+
+    const auto first_deferred = [](const taul::parse_tree& tree) -> std::optional<size_t> {
+        for (const auto& I : tree) {
+            if (I.is_deferred()) return I.index();
+        }
+        return std::nullopt;
+    };
+
+    const auto output_before_expand = lstnr.output;
+
+    auto expanded_1 = psr.expand(result, result.at(1), src);
+    ASSERT_TRUE(expanded_1.is_sealed());
+    ASSERT_TRUE(first_deferred(expanded_1));
+    ASSERT_EQ(expanded_1.at(first_deferred(expanded_1).value()).pos(), 2); // <- the nested Block
+    auto expanded_2 = psr.expand(expanded_1, expanded_1.at(first_deferred(expanded_1).value()), src);
+    ASSERT_TRUE(first_deferred(expanded_2));
+    ASSERT_EQ(expanded_2.at(first_deferred(expanded_2).value()).pos(), 8);
+    auto expanded_3 = psr.expand(expanded_2, expanded_2.at(first_deferred(expanded_2).value()), src);
+
+    EXPECT_FALSE(first_deferred(expanded_3));
+
+    // the listener doesn't receive events for expanded subtrees
+
+    EXPECT_EQ(lstnr.output, output_before_expand);
+
+    psr.clear_deferrals();
+    EXPECT_FALSE(psr.is_deferred(gram->ppr("Block"_str).value()));
+
+    psr.reset();
+    auto expected_expanded = psr.parse("Top"_str);
+
+    TAUL_LOG(lgr, "expanded_3:\n{}\nexpected_expanded:\n{}", expanded_3, expected_expanded);
+
+    EXPECT_EQ(expanded_3, expected_expanded);
+    EXPECT_FALSE(expanded_3.is_aborted());
+}
+
+TEST(ParserTests, Reparse) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto old_src = "{x{x}x}y{x}"_str;
+
+    taul::source_reader input(old_src);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    psr.reset();
+    const auto old = psr.parse("Top"_str);
+    ASSERT_FALSE(old.is_aborted());
+
+    // replace the 'x' at pos 9 w/ '{}'
+
+    const auto new_src = "{x{x}x}y{{}}"_str;
+
+    input.change_input(new_src);
+    psr.reset();
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+    const auto result = psr.reparse(old, 9, 1, 2);
+
+    psr.reset();
+    test_listener expected_lstnr{};
+    psr.bind_listener(&expected_lstnr);
+    const auto expected = psr.parse("Top"_str);
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result.tree, expected);
+
+    EXPECT_EQ(result.tree, expected);
+    EXPECT_FALSE(result.tree.is_aborted());
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+
+    // the first Block's subtree (nodes 1 to 13) should be reused, w/ all
+    // other nodes having changed
+
+    std::vector<size_t> expected_changed{ 0 };
+    for (size_t i = 14; i < expected.nodes(); i++) expected_changed.push_back(i);
+
+    EXPECT_EQ(result.changed, expected_changed);
+}
+
+TEST(ParserTests, Reparse_ReuseAfterEdit) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto old_src = "{x}y{x{x}}"_str;
+
+    taul::source_reader input(old_src);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    psr.reset();
+    const auto old = psr.parse("Top"_str);
+    ASSERT_FALSE(old.is_aborted());
+
+    // insert 'xx' at pos 1, which shifts the second Block's position
+
+    const auto new_src = "{xxx}y{x{x}}"_str;
+
+    input.change_input(new_src);
+    psr.reset();
+    const auto result = psr.reparse(old, 1, 0, 2);
+
+    psr.reset();
+    const auto expected = psr.parse("Top"_str);
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result.tree, expected);
+
+    EXPECT_EQ(result.tree, expected);
+
+    // the second Block's subtree should be reused
+
+    const size_t second_block = expected.root().right_child()->index();
+    std::vector<size_t> expected_changed{};
+    for (size_t i = 0; i < second_block; i++) expected_changed.push_back(i);
+
+    EXPECT_EQ(result.changed, expected_changed);
+}
+
+TEST(ParserTests, Reparse_NoReuseOfAbortedSpine) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto old_src = "{x}y{x{x"_str;
+
+    taul::source_reader input(old_src);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    psr.reset();
+    const auto old = psr.parse("Top"_str);
+    ASSERT_TRUE(old.is_aborted());
+
+    // complete the input by appending '}}'
+
+    const auto new_src = "{x}y{x{x}}"_str;
+
+    input.change_input(new_src);
+    psr.reset();
+    const auto result = psr.reparse(old, 8, 0, 2);
+
+    psr.reset();
+    const auto expected = psr.parse("Top"_str);
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result.tree, expected);
+
+    EXPECT_EQ(result.tree, expected);
+    EXPECT_FALSE(result.tree.is_aborted());
+}
+
+TEST(ParserTests, Splice) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto src = "{x{x}x}y{x}"_str;
+
+    taul::source_reader input(src);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    lxr.reset();
+    const taul::token_buffer tokens(lxr);
+
+    taul::parser psr(gram.value(), lgr);
+
+    // parse the nested Block at token 2 (pos 2), and the Block at token 8 (pos 8),
+    // separately from the rest of the input
+
+    std::vector<taul::parse_tree> subtrees{};
+    for (size_t index : { 2, 8 }) {
+        const auto cursor = tokens.make_cursor();
+        psr.bind_source(cursor);
+        psr.reset();
+        cursor->seek(index);
+        subtrees.push_back(psr.parse("Block"_str));
+        ASSERT_FALSE(subtrees.back().is_aborted());
+    }
+
+    psr.bind_source(tokens.make_cursor());
+    psr.reset();
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+    const auto result = psr.splice("Top"_str, subtrees);
+
+    psr.reset();
+    test_listener expected_lstnr{};
+    psr.bind_listener(&expected_lstnr);
+    const auto expected = psr.parse("Top"_str);
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result, expected);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_FALSE(result.is_aborted());
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+}
+
+// listener which takes checkpoints of the whole pipeline upon the Nth 
+// on_lexical, and which then throws upon the Mth on_lexical
+
+class checkpointing_listener final : public taul::listener {
+public:
+
+    taul::source_reader* input = nullptr;
+    taul::lexer* lxr = nullptr;
+    taul::parser* psr = nullptr;
+
+    size_t checkpoint_at = 0, throw_at = 0, lexicals = 0;
+
+    test_listener inner{};
+
+    std::optional<taul::source_reader::checkpoint_t> input_cp;
+    std::optional<taul::lexer::checkpoint_t> lxr_cp;
+    std::optional<taul::parser::checkpoint_t> psr_cp;
+    std::string output_at_cp;
+
+
+    inline void on_startup() override { inner.on_startup(); }
+    inline void on_shutdown() override { inner.on_shutdown(); }
+
+    inline void on_lexical(taul::token tkn) override {
+        inner.on_lexical(tkn);
+        lexicals++;
+        if (lexicals == checkpoint_at) {
+            input_cp = input->checkpoint();
+            lxr_cp = lxr->checkpoint();
+            psr_cp = psr->checkpoint();
+            output_at_cp = inner.output;
+        }
+        if (lexicals == throw_at) throw std::runtime_error("listener failure");
+    }
+
+    inline void on_syntactic(taul::ppr_ref ppr, taul::source_pos pos) override { inner.on_syntactic(ppr, pos); }
+    inline void on_close() override { inner.on_close(); }
+    inline void on_abort() override { inner.on_abort(); }
+    inline void on_terminal_error(taul::token_range ids, taul::token input) override { inner.on_terminal_error(ids, input); }
+    inline void on_nonterminal_error(taul::symbol_id id, taul::token input) override { inner.on_nonterminal_error(id, input); }
+};
+
+TEST(ParserTests, CheckpointAndResume) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_parser_tests_grammar_for_deferral(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::source_reader input("{x{x}x}y{x}"_str);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&input);
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(&lxr);
+
+    psr.reset();
+    test_listener expected_lstnr{};
+    psr.bind_listener(&expected_lstnr);
+    const auto expected = psr.parse("Top"_str);
+    ASSERT_FALSE(expected.is_aborted());
+
+    checkpointing_listener lstnr{};
+    lstnr.input = &input;
+    lstnr.lxr = &lxr;
+    lstnr.psr = &psr;
+    lstnr.checkpoint_at = 4;
+    lstnr.throw_at = 9;
+
+    psr.reset();
+    psr.bind_listener(&lstnr);
+    EXPECT_THROW(psr.parse("Top"_str), std::runtime_error);
+    ASSERT_TRUE(lstnr.input_cp);
+    ASSERT_TRUE(lstnr.lxr_cp);
+    ASSERT_TRUE(lstnr.psr_cp);
+
+    // restore the pipeline, and the listener's output, to how they were
+    // at the checkpoint, and then resume
+
+    lstnr.throw_at = 0;
+    lstnr.inner.output = lstnr.output_at_cp;
+    input.restore(lstnr.input_cp.value());
+    lxr.restore(lstnr.lxr_cp.value());
+    psr.restore(lstnr.psr_cp.value());
+    const auto result = psr.resume();
+
+    TAUL_LOG(lgr, "result:\n{}\nexpected:\n{}", result, expected);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(lstnr.inner.output, expected_lstnr.output);
+
+    // checkpoints should also be reusable multiple times
+
+    lstnr.inner.output = lstnr.output_at_cp;
+    input.restore(lstnr.input_cp.value());
+    lxr.restore(lstnr.lxr_cp.value());
+    psr.restore(lstnr.psr_cp.value());
+    EXPECT_EQ(psr.resume(), expected);
+    EXPECT_EQ(lstnr.inner.output, expected_lstnr.output);
+}
@@ -0,0 +1,167 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/push_parser.h>
+
+#include "helpers/test_listener.h"
+#include "helpers/test_error_handler_for_input_recording.h"
+#include "helpers/test_items_grammar.h"
+
+
+using namespace taul::string_literals;
+
+
+static std::string parse_in_full(taul::grammar gram, const taul::str& input, std::shared_ptr<taul::logger> lgr) {
+    taul::source_reader rdr(input);
+    taul::lexer lxr(gram, lgr);
+    lxr.bind_source(&rdr);
+    taul::parser psr(gram, lgr);
+    psr.bind_source(&lxr);
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+    psr.reset();
+    psr.parse_notree("Top"_str);
+    return lstnr.output;
+}
+
+static std::string parse_in_chunks(taul::grammar gram, const taul::str& input, size_t chunk_size, std::shared_ptr<taul::logger> lgr) {
+    taul::push_parser psr(gram, taul::utf8, lgr);
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+    psr.start("Top"_str);
+    for (size_t i = 0; i < input.length(); i += chunk_size) {
+        const auto chunk = input.substr(i, chunk_size);
+        psr.feed(std::span<const char>(chunk.data(), chunk.length()));
+    }
+    EXPECT_TRUE(psr.running());
+    psr.finish();
+    EXPECT_FALSE(psr.running());
+    return lstnr.output;
+}
+
+TEST(PushParserTests, Chunks) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto input = "abc {de  {f} g}x {}  "_str;
+    const auto expected = parse_in_full(gram.value(), input, lgr);
+
+    for (size_t chunk_size = 1; chunk_size <= input.length() + 1; chunk_size++) {
+        TAUL_LOG(lgr, "chunk_size=={}", chunk_size);
+        EXPECT_EQ(parse_in_chunks(gram.value(), input, chunk_size, lgr), expected);
+    }
+}
+
+TEST(PushParserTests, Chunks_WithError) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    const auto input = "abc {de} } f"_str;
+    const auto expected = parse_in_full(gram.value(), input, lgr);
+
+    for (size_t chunk_size = 1; chunk_size <= input.length() + 1; chunk_size++) {
+        TAUL_LOG(lgr, "chunk_size=={}", chunk_size);
+        EXPECT_EQ(parse_in_chunks(gram.value(), input, chunk_size, lgr), expected);
+    }
+}
+
+TEST(PushParserTests, Incremental) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::push_parser psr(gram.value(), taul::utf8, lgr);
+    test_listener lstnr{};
+    psr.bind_listener(&lstnr);
+    psr.start("Top"_str);
+
+    // 'ab' may yet be extended, so neither it, nor '{' (as the lexer
+    // lexes one token ahead) are produced yet
+
+    psr.feed(std::string_view("{ab"));
+
+    test_listener expected{};
+    expected.on_startup();
+
+    EXPECT_EQ(lstnr.output, expected.output);
+
+    // now '{' and 'abc' are known, but '}' isn't, as the whitespace
+    // after it may yet be extended
+
+    psr.feed(std::string_view("c} "));
+
+    expected.on_syntactic(gram->ppr("Top"_str).value(), 0);
+    expected.on_syntactic(gram->ppr("Item"_str).value(), 0);
+    expected.on_lexical(taul::token::normal(gram.value(), "lb"_str, 0, 1));
+    expected.on_syntactic(gram->ppr("Item"_str).value(), 1);
+    expected.on_lexical(taul::token::normal(gram.value(), "ident"_str, 1, 3));
+    expected.on_close();
+
+    EXPECT_EQ(lstnr.output, expected.output);
+
+    psr.finish();
+
+    expected.on_lexical(taul::token::normal(gram.value(), "rb"_str, 4, 1));
+    expected.on_close();
+    expected.on_close();
+    expected.on_shutdown();
+
+    EXPECT_EQ(lstnr.output, expected.output);
+}
+
+TEST(PushParserTests, ErrorHandlerStartupAndShutdownArePaired) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::push_parser psr(gram.value(), taul::utf8, lgr);
+    test_error_handler_for_input_recording eh{};
+    psr.bind_error_handler(&eh);
+    psr.start("Top"_str);
+
+    // suspending/resuming upon each chunk shouldn't begin new rounds of parsing
+
+    for (size_t i = 0; i < 10; i++) {
+        psr.feed(std::string_view("{abc def} "));
+    }
+    psr.finish();
+
+    size_t startups = 0, shutdowns = 0;
+    for (size_t i = eh.output.find("startup("); i != std::string::npos; i = eh.output.find("startup(", i + 1)) startups++;
+    for (size_t i = eh.output.find("shutdown("); i != std::string::npos; i = eh.output.find("shutdown(", i + 1)) shutdowns++;
+
+    EXPECT_EQ(startups, 1);
+    EXPECT_EQ(shutdowns, 1);
+    EXPECT_TRUE(eh.output.starts_with("\nstartup("));
+    EXPECT_TRUE(eh.output.ends_with("\nshutdown()"));
+}
+
+TEST(PushParserTests, BoundedMemory) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    taul::push_parser psr(gram.value(), taul::utf8, lgr);
+    psr.start("Top"_str);
+
+    // consumed input should be discarded, rather than accumulating
+
+    for (size_t i = 0; i < 1000; i++) {
+        psr.feed(std::string_view("{abc def} "));
+        EXPECT_LE(psr.buffered_chars(), 10);
+        EXPECT_LE(psr.buffered_tokens(), 4);
+    }
+    psr.finish();
+
+    EXPECT_FALSE(psr.running());
+}
+
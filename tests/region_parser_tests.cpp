@@ -0,0 +1,163 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/token_buffer.h>
+#include <taul/regular_error_handler.h>
+#include <taul/region_parser.h>
+
+#include "helpers/test_listener.h"
+#include "helpers/test_items_grammar.h"
+
+
+using namespace taul::string_literals;
+
+
+// Item may be followed by an optional second ident, so not every ident
+// at nesting depth 0 begins an Item, making some boundaries unsafe
+
+static constexpr test_items_grammar_options region_parser_tests_grammar_options{
+    .end_anchored = true,
+    .newlines = true,
+    .semi_prefix = true,
+    .ident_pairs = true,
+};
+
+static taul::str make_region_parser_tests_input(size_t items) {
+    std::string result = ";";
+    for (size_t i = 0; i < items; i++) {
+        switch (i % 4) {
+        case 0: result += " abc"; break;
+        case 1: result += " de fg"; break;
+        case 2: result += " {h {i j} k}"; break;
+        default: result += "\n{}"; break;
+        }
+    }
+    return taul::str(result);
+}
+
+static taul::token_buffer lex_for_region_parser_tests(const taul::grammar& gram, const taul::str& input) {
+    taul::source_reader rdr(input);
+    taul::lexer lxr(gram);
+    lxr.bind_source(&rdr);
+    lxr.reset();
+    return taul::token_buffer(lxr);
+}
+
+static taul::parse_tree parse_for_region_parser_tests(const taul::grammar& gram, const taul::token_buffer& tokens, taul::listener* lstnr = nullptr, taul::error_handler* eh = nullptr) {
+    taul::parser psr(gram);
+    psr.bind_source(tokens.make_cursor());
+    psr.bind_listener(lstnr);
+    psr.bind_error_handler(eh);
+    psr.reset();
+    return psr.parse("Top"_str);
+}
+
+TEST(RegionParserTests, Parse) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), region_parser_tests_grammar_options);
+    ASSERT_TRUE(gram);
+
+    const auto tokens = lex_for_region_parser_tests(gram.value(), make_region_parser_tests_input(1000));
+
+    taul::region_parser rp(gram.value(), 4);
+    rp.bracket(gram->lpr("lb"_str).value(), gram->lpr("rb"_str).value());
+    rp.region_size(16);
+
+    EXPECT_EQ(rp.workers(), 4);
+    EXPECT_EQ(rp.region_size(), 16);
+
+    test_listener lstnr{};
+    rp.bind_listener(&lstnr);
+    const auto result = rp.parse(tokens, "Top"_str, "Item"_str);
+
+    test_listener expected_lstnr{};
+    const auto expected = parse_for_region_parser_tests(gram.value(), tokens, &expected_lstnr);
+
+    EXPECT_GT(rp.regions(), 1);
+    EXPECT_GT(rp.subtrees(), 0);
+
+    EXPECT_FALSE(result.is_aborted());
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+}
+
+TEST(RegionParserTests, Parse_SmallInput) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), region_parser_tests_grammar_options);
+    ASSERT_TRUE(gram);
+
+    const auto tokens = lex_for_region_parser_tests(gram.value(), make_region_parser_tests_input(10));
+
+    taul::region_parser rp(gram.value(), 4);
+
+    const auto result = rp.parse(tokens, "Top"_str, "Item"_str);
+
+    // too small to be worth splitting, so parsed on a single thread
+
+    EXPECT_EQ(rp.regions(), 0);
+    EXPECT_EQ(rp.subtrees(), 0);
+
+    EXPECT_EQ(result, parse_for_region_parser_tests(gram.value(), tokens));
+}
+
+TEST(RegionParserTests, Parse_WithErrors) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_test_items_grammar(lgr, region_parser_tests_grammar_options);
+    ASSERT_TRUE(gram);
+
+    // inject some syntax errors, w/ some being at depth 0 and others nested
+
+    std::string input(std::string_view(make_region_parser_tests_input(1000)));
+    input[input.size() / 3] = ';';
+    input[input.size() / 2] = '}';
+
+    const auto tokens = lex_for_region_parser_tests(gram.value(), taul::str(input));
+
+    taul::region_parser rp(gram.value(), 4);
+    rp.bracket(gram->lpr("lb"_str).value(), gram->lpr("rb"_str).value());
+    rp.region_size(16);
+
+    taul::regular_error_handler eh(lgr);
+    rp.bind_error_handler(&eh);
+    test_listener lstnr{};
+    rp.bind_listener(&lstnr);
+    const auto result = rp.parse(tokens, "Top"_str, "Item"_str);
+
+    taul::regular_error_handler expected_eh(lgr);
+    test_listener expected_lstnr{};
+    const auto expected = parse_for_region_parser_tests(gram.value(), tokens, &expected_lstnr, &expected_eh);
+
+    EXPECT_GT(rp.subtrees(), 0);
+    EXPECT_GT(expected_lstnr.terminal_errors + expected_lstnr.nonterminal_errors, 0);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result.is_aborted(), expected.is_aborted());
+    EXPECT_EQ(lstnr.output, expected_lstnr.output);
+    EXPECT_EQ(lstnr.terminal_errors, expected_lstnr.terminal_errors);
+    EXPECT_EQ(lstnr.nonterminal_errors, expected_lstnr.nonterminal_errors);
+}
+
+TEST(RegionParserTests, Parse_NoBrackets) {
+    auto gram = make_test_items_grammar(taul::make_stderr_logger(), region_parser_tests_grammar_options);
+    ASSERT_TRUE(gram);
+
+    const auto tokens = lex_for_region_parser_tests(gram.value(), make_region_parser_tests_input(1000));
+
+    // w/out brackets, boundaries may be placed within nested Items, w/ the
+    // result nevertheless needing to be correct
+
+    taul::region_parser rp(gram.value(), 3);
+    rp.region_size(7);
+
+    const auto result = rp.parse(tokens, "Top"_str, "Item"_str);
+
+    EXPECT_GT(rp.subtrees(), 0);
+
+    EXPECT_EQ(result, parse_for_region_parser_tests(gram.value(), tokens));
+}
+
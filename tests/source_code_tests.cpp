@@ -645,6 +645,21 @@ TEST(SourceCodeTests, AddFile_FileIsEncodedAsUTF8BOM) {
     ASSERT_EQ(taul::check_bom(taul::utf8, std::string_view(src.str())), taul::bom_status::no_bom);
 }
 
+TEST(SourceCodeTests, AddFileContents) {
+    const auto path = std::filesystem::current_path() / "abc.taul";
+
+    taul::source_code src{};
+    src.add_file_contents(path, "abc\ndef"_str);
+    src.add_file_contents(path, "\xEF\xBB\xBFghi"_str); // <- w/ UTF-8 BOM, which is filtered out
+
+    EXPECT_EQ(src.str(), "abc\ndefghi"_str);
+    ASSERT_EQ(src.pages().size(), 2);
+    EXPECT_EQ(src.pages()[0].origin, "abc.taul"_str);
+    EXPECT_EQ(src.pages()[0].length, 7);
+    EXPECT_EQ(src.pages()[1].origin, "abc.taul"_str);
+    EXPECT_EQ(src.pages()[1].length, 3);
+}
+
 TEST(SourceCodeTests, Reset) {
     taul::source_code sc{};
     sc.add_str("aa"_str, "abc"_str);
@@ -0,0 +1,278 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/spec.h>
+#include <taul/grammar.h>
+#include <taul/load.h>
+#include <taul/source_reader.h>
+#include <taul/lexer.h>
+#include <taul/parser.h>
+#include <taul/token_queue.h>
+#include <taul/token_buffer.h>
+
+#include "parameterized_tests/token_stream_tests.h"
+
+
+using namespace taul::string_literals;
+
+
+// test w/ non-empty input
+
+static TokenStreamParam _make_param_1() {
+    taul::token_buffer buff(
+        {
+            taul::token::failure(0, 1),
+            taul::token::failure(1, 1),
+            taul::token::failure(2, 1),
+        },
+        taul::token::end(3));
+    std::size_t n_after_done = 3;
+    return TokenStreamParam::init(buff.make_cursor(), n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TokenBuffer_NonEmptyInput,
+    TokenStreamTests,
+    testing::Values(_make_param_1()));
+
+
+// test w/ empty input
+
+static TokenStreamParam _make_param_2() {
+    taul::token_buffer buff{};
+    std::size_t n_after_done = 0;
+    return TokenStreamParam::init(buff.make_cursor(), n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TokenBuffer_EmptyInput,
+    TokenStreamTests,
+    testing::Values(_make_param_2()));
+
+
+static std::optional<taul::grammar> make_token_buffer_tests_grammar(std::shared_ptr<taul::logger> lgr) {
+    auto spec =
+        taul::spec_writer()
+        .lpr_decl("ws"_str)
+        .lpr_decl("ident"_str)
+        .lpr_decl("num"_str)
+        .ppr_decl("Idents"_str)
+        .ppr_decl("Mixed"_str)
+        .lpr("ws"_str, taul::skip)
+        .kleene_plus()
+        .charset(" "_str)
+        .close()
+        .close()
+        .lpr("ident"_str)
+        .kleene_plus()
+        .charset("a-z"_str)
+        .close()
+        .close()
+        .lpr("num"_str)
+        .kleene_plus()
+        .charset("0-9"_str)
+        .close()
+        .close()
+        .ppr("Idents"_str)
+        .kleene_star()
+        .name("ident"_str)
+        .close()
+        .end()
+        .close()
+        .ppr("Mixed"_str)
+        .kleene_star()
+        .sequence()
+        .name("ident"_str)
+        .alternative()
+        .name("num"_str)
+        .close()
+        .close()
+        .end()
+        .close()
+        .done();
+    return taul::load(spec, lgr);
+}
+
+TEST(TokenBufferTests, DefaultCtor) {
+    taul::token_buffer buff{};
+
+    EXPECT_EQ(buff.size(), 0);
+    EXPECT_TRUE(buff.tokens().empty());
+    EXPECT_EQ(buff.end(), taul::token::end(0));
+    EXPECT_EQ(buff.at(0), taul::token::end(0));
+}
+
+TEST(TokenBufferTests, TokenStreamCtor) {
+    taul::token_queue q{};
+    q.push(taul::token::failure(0, 1));
+    q.push(taul::token::failure(1, 2));
+    q.push(taul::token::end(3));
+
+    taul::token_buffer buff(q);
+
+    EXPECT_TRUE(q.done());
+
+    ASSERT_EQ(buff.size(), 2);
+    EXPECT_EQ(buff.at(0), taul::token::failure(0, 1));
+    EXPECT_EQ(buff.at(1), taul::token::failure(1, 2));
+    EXPECT_EQ(buff.at(2), taul::token::end(3));
+    EXPECT_EQ(buff.end(), taul::token::end(3));
+    EXPECT_EQ(buff.tokens().size(), 2);
+}
+
+TEST(TokenBufferTests, IndependentCursors) {
+    taul::token_buffer buff(
+        {
+            taul::token::failure(0, 1),
+            taul::token::failure(1, 1),
+        },
+        taul::token::end(2));
+
+    auto a = buff.make_cursor();
+    auto b = buff.make_cursor();
+
+    EXPECT_EQ(a->next(), taul::token::failure(0, 1));
+    EXPECT_EQ(a->next(), taul::token::failure(1, 1));
+    EXPECT_TRUE(a->done());
+
+    EXPECT_FALSE(b->done());
+    EXPECT_EQ(b->position(), 0);
+    EXPECT_EQ(b->next(), taul::token::failure(0, 1));
+
+    a->reset();
+
+    EXPECT_EQ(a->position(), 0);
+    EXPECT_EQ(b->position(), 1);
+}
+
+TEST(TokenBufferTests, CursorOutlivesBuffer) {
+    std::shared_ptr<taul::token_buffer::cursor> c{};
+    {
+        taul::token_buffer buff({ taul::token::failure(0, 1) }, taul::token::end(1));
+        c = buff.make_cursor();
+    }
+
+    EXPECT_EQ(c->next(), taul::token::failure(0, 1));
+    EXPECT_EQ(c->next(), taul::token::end(1));
+}
+
+TEST(TokenBufferTests, PositionAndSeek) {
+    taul::token_buffer buff(
+        {
+            taul::token::failure(0, 1),
+            taul::token::failure(1, 1),
+            taul::token::failure(2, 1),
+        },
+        taul::token::end(3));
+
+    taul::token_buffer::cursor c(buff);
+
+    EXPECT_EQ(c.next(), taul::token::failure(0, 1));
+
+    const size_t saved = c.position();
+
+    EXPECT_EQ(saved, 1);
+    EXPECT_EQ(c.next(), taul::token::failure(1, 1));
+    EXPECT_EQ(c.next(), taul::token::failure(2, 1));
+    EXPECT_TRUE(c.done());
+
+    c.seek(saved);
+
+    EXPECT_FALSE(c.done());
+    EXPECT_EQ(c.peek(), taul::token::failure(1, 1));
+
+    c.seek(100); // clamped
+
+    EXPECT_EQ(c.position(), 3);
+    EXPECT_TRUE(c.done());
+    EXPECT_EQ(c.next(), taul::token::end(3));
+}
+
+TEST(TokenBufferTests, ParseMultipleStartRules) {
+    auto gram = make_token_buffer_tests_grammar(taul::make_stderr_logger());
+    ASSERT_TRUE(gram);
+
+    const auto input = "abc 12 de"_str;
+
+    taul::source_reader rdr(input);
+    taul::lexer lxr(gram.value());
+    lxr.bind_source(&rdr);
+    lxr.reset();
+
+    const taul::token_buffer buff(lxr);
+
+    EXPECT_EQ(buff.size(), 3);
+
+    // parse w/ each start rule, w/out having to re-lex
+
+    const auto parse = [&](const taul::str& start_rule) -> taul::parse_tree {
+        taul::parser psr(gram.value());
+        psr.bind_source(buff.make_cursor());
+        psr.reset();
+        return psr.parse(start_rule);
+        };
+
+    // expected outputs are derived from parsing via a live lexer
+
+    const auto expected = [&](const taul::str& start_rule) -> taul::parse_tree {
+        taul::source_reader rdr(input);
+        taul::lexer lxr(gram.value());
+        lxr.bind_source(&rdr);
+        taul::parser psr(gram.value());
+        psr.bind_source(&lxr);
+        psr.reset();
+        return psr.parse(start_rule);
+        };
+
+    const auto idents = parse("Idents"_str);
+    const auto mixed = parse("Mixed"_str);
+
+    EXPECT_TRUE(idents.is_aborted());
+    EXPECT_FALSE(mixed.is_aborted());
+
+    EXPECT_EQ(idents, expected("Idents"_str));
+    EXPECT_EQ(mixed, expected("Mixed"_str));
+}
+
+
+TEST(TokenBufferTests, LimitExceeded) {
+    auto lgr = taul::make_stderr_logger();
+    auto gram = make_token_buffer_tests_grammar(lgr);
+    ASSERT_TRUE(gram);
+
+    EXPECT_FALSE(taul::token_buffer{}.limit_exceeded());
+    EXPECT_FALSE(taul::token_buffer{}.make_cursor()->limit_exceeded());
+
+    taul::source_reader rdr("ab abcdef"_str);
+    taul::lexer lxr(gram.value(), lgr);
+    lxr.bind_source(&rdr);
+    lxr.limit(3);
+    lxr.reset();
+
+    taul::token_buffer buff(lxr);
+
+    EXPECT_TRUE(buff.limit_exceeded());
+
+    // cursors only report limit_exceeded once they reach end-of-input
+
+    const auto cursor = buff.make_cursor(lgr);
+
+    EXPECT_FALSE(cursor->limit_exceeded());
+    cursor->next();
+    EXPECT_FALSE(cursor->limit_exceeded());
+    cursor->seek(buff.size());
+    EXPECT_TRUE(cursor->limit_exceeded());
+    cursor->reset();
+    EXPECT_FALSE(cursor->limit_exceeded());
+
+    // parsers downstream of the cursor abort, as they would've w/ the lexer
+
+    taul::parser psr(gram.value(), lgr);
+    psr.bind_source(cursor);
+    psr.limit(taul::parse_limits{ .max_lookahead = 3 });
+    psr.reset();
+
+    EXPECT_TRUE(psr.parse("Idents"_str).is_aborted());
+    EXPECT_TRUE(psr.limit_exceeded());
+}
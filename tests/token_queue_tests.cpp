@@ -0,0 +1,95 @@
+
+
+#include <gtest/gtest.h>
+
+#include <taul/token_queue.h>
+
+#include "parameterized_tests/token_stream_tests.h"
+
+
+using namespace taul::string_literals;
+
+
+// test w/ non-empty input
+
+static TokenStreamParam _make_param_1() {
+    auto stream = std::make_shared<taul::token_queue>();
+    stream->push(taul::token::failure(0, 1));
+    stream->push(taul::token::failure(1, 1));
+    stream->push(taul::token::failure(2, 1));
+    stream->push(taul::token::end(3));
+    std::size_t n_after_done = 3;
+    return TokenStreamParam::init(stream, n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TokenQueue_NonEmptyInput,
+    TokenStreamTests,
+    testing::Values(_make_param_1()));
+
+
+// test w/ empty input
+
+static TokenStreamParam _make_param_2() {
+    auto stream = std::make_shared<taul::token_queue>();
+    stream->push(taul::token::end(0));
+    std::size_t n_after_done = 0;
+    return TokenStreamParam::init(stream, n_after_done);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TokenQueue_EmptyInput,
+    TokenStreamTests,
+    testing::Values(_make_param_2()));
+
+
+TEST(TokenQueueTests, ReadyAndFinished) {
+    taul::token_queue q{};
+
+    EXPECT_FALSE(q.ready());
+    EXPECT_FALSE(q.finished());
+    EXPECT_FALSE(q.done());
+
+    q.push(taul::token::failure(0, 2));
+
+    EXPECT_TRUE(q.ready());
+    EXPECT_EQ(q.next(), taul::token::failure(0, 2));
+    EXPECT_FALSE(q.ready());
+    EXPECT_FALSE(q.done());
+
+    q.push(taul::token::end(2));
+
+    EXPECT_TRUE(q.ready());
+    EXPECT_TRUE(q.finished());
+    EXPECT_TRUE(q.done());
+    EXPECT_EQ(q.next(), taul::token::end(2));
+    EXPECT_TRUE(q.ready());
+}
+
+TEST(TokenQueueTests, Discard) {
+    taul::token_queue q{};
+
+    q.push(taul::token::failure(0, 1));
+    q.push(taul::token::failure(1, 1));
+    q.push(taul::token::failure(2, 1));
+
+    EXPECT_EQ(q.next(), taul::token::failure(0, 1));
+
+    q.discard();
+
+    EXPECT_EQ(q.buffered(), 2);
+
+    EXPECT_EQ(q.next(), taul::token::failure(1, 1));
+
+    // reset rewinds to the start of non-discarded tokens
+
+    q.reset();
+
+    EXPECT_EQ(q.next(), taul::token::failure(1, 1));
+
+    q.clear();
+
+    EXPECT_EQ(q.buffered(), 0);
+    EXPECT_FALSE(q.ready());
+}
+